@@ -0,0 +1,119 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the counting global operator new of the allocation tracking
+ * @file AllocationHooks.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "AllocationTracker.h"
+#include <cstdlib>
+#include <new>
+
+using namespace bcostars;
+
+// Note: the replaced allocation functions are kept apart from the allocating code of the
+// tracker, so the compiler doesn't pair the inlined malloc and free with new and delete
+#ifdef BCOS_TARS_ALLOCATION_TRACKING
+namespace
+{
+std::atomic<uint64_t> g_allocations = {0};
+std::atomic<uint64_t> g_allocatedBytes = {0};
+
+// Note: must not allocate, it is called by operator new
+void countAllocation(std::size_t _size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_allocatedBytes.fetch_add(_size, std::memory_order_relaxed);
+    AllocationScope::onAllocation(_size);
+}
+
+void* trackedAlloc(std::size_t _size)
+{
+    countAllocation(_size);
+    return std::malloc(_size == 0 ? 1 : _size);
+}
+
+void* trackedAlignedAlloc(std::size_t _size, std::align_val_t _alignment)
+{
+    countAllocation(_size);
+    auto alignment = (std::size_t)_alignment;
+    // aligned_alloc requires the size to be a multiple of the alignment
+    auto size = (_size + alignment - 1) / alignment * alignment;
+    return std::aligned_alloc(alignment, size == 0 ? alignment : size);
+}
+}  // namespace
+#endif
+
+AllocationCounts bcostars::allocationTotals()
+{
+#ifdef BCOS_TARS_ALLOCATION_TRACKING
+    return AllocationCounts{g_allocations.load(std::memory_order_relaxed),
+        g_allocatedBytes.load(std::memory_order_relaxed)};
+#else
+    return AllocationCounts();
+#endif
+}
+
+#ifdef BCOS_TARS_ALLOCATION_TRACKING
+// the replaced global allocation functions, the others forward to these by the standard
+void* operator new(std::size_t _size)
+{
+    if (auto pointer = trackedAlloc(_size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t _size, std::nothrow_t const&) noexcept
+{
+    return trackedAlloc(_size);
+}
+
+void* operator new(std::size_t _size, std::align_val_t _alignment)
+{
+    if (auto pointer = trackedAlignedAlloc(_size, _alignment))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t _size, std::align_val_t _alignment, std::nothrow_t const&) noexcept
+{
+    return trackedAlignedAlloc(_size, _alignment);
+}
+
+void operator delete(void* _pointer) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete(void* _pointer, std::size_t) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete(void* _pointer, std::align_val_t) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete(void* _pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(_pointer);
+}
+#endif
@@ -0,0 +1,136 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief attribute the heap allocations to the protocol operations
+ * @file AllocationTracker.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "AllocationTracker.h"
+#include <sstream>
+
+using namespace bcostars;
+
+namespace
+{
+thread_local AllocationScope* t_currentScope = nullptr;
+
+}  // namespace
+
+AllocationSiteSnapshot AllocationSite::snapshot() const
+{
+    AllocationSiteSnapshot snapshot;
+    snapshot.name = m_name;
+    snapshot.scopes = m_scopes.load(std::memory_order_relaxed);
+    snapshot.allocations = m_allocations.load(std::memory_order_relaxed);
+    snapshot.bytes = m_bytes.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void AllocationSite::reset()
+{
+    m_scopes.store(0, std::memory_order_relaxed);
+    m_allocations.store(0, std::memory_order_relaxed);
+    m_bytes.store(0, std::memory_order_relaxed);
+}
+
+AllocationSite& AllocationSites::site(std::string const& _name)
+{
+    std::lock_guard<std::mutex> lock(x_sites);
+    auto& site = m_sites[_name];
+    if (!site)
+    {
+        site = std::make_unique<AllocationSite>(_name);
+    }
+    return *site;
+}
+
+std::vector<AllocationSiteSnapshot> AllocationSites::snapshot() const
+{
+    std::vector<AllocationSiteSnapshot> snapshots;
+    std::lock_guard<std::mutex> lock(x_sites);
+    snapshots.reserve(m_sites.size());
+    for (auto const& it : m_sites)
+    {
+        snapshots.emplace_back(it.second->snapshot());
+    }
+    return snapshots;
+}
+
+void AllocationSites::reset()
+{
+    std::lock_guard<std::mutex> lock(x_sites);
+    for (auto const& it : m_sites)
+    {
+        it.second->reset();
+    }
+}
+
+std::string AllocationSites::toPrometheusText() const
+{
+    auto snapshots = snapshot();
+    std::stringstream output;
+    auto writeMetric = [&](std::string const& _name, std::string const& _help, auto _getter) {
+        output << "# HELP " << _name << " " << _help << "\n";
+        output << "# TYPE " << _name << " counter\n";
+        for (auto const& it : snapshots)
+        {
+            output << _name << "{site=\"" << it.name << "\"} " << _getter(it) << "\n";
+        }
+    };
+    writeMetric("bcos_alloc_scopes_total", "Sampled executions of the allocation sites",
+        [](AllocationSiteSnapshot const& _snapshot) { return _snapshot.scopes; });
+    writeMetric("bcos_alloc_count_total", "Heap allocations of the sampled executions",
+        [](AllocationSiteSnapshot const& _snapshot) { return _snapshot.allocations; });
+    writeMetric("bcos_alloc_bytes_total", "Heap bytes allocated by the sampled executions",
+        [](AllocationSiteSnapshot const& _snapshot) { return _snapshot.bytes; });
+    return output.str();
+}
+
+AllocationScope::AllocationScope(AllocationSite& _site)
+{
+    if (!_site.sample(AllocationSites::instance().sampleRate()))
+    {
+        return;
+    }
+    m_site = &_site;
+    m_parent = t_currentScope;
+    t_currentScope = this;
+}
+
+AllocationScope::~AllocationScope()
+{
+    if (!m_site)
+    {
+        return;
+    }
+    t_currentScope = m_parent;
+    if (m_parent)
+    {
+        m_parent->m_counts.count += m_counts.count;
+        m_parent->m_counts.bytes += m_counts.bytes;
+    }
+    m_site->record(m_counts);
+}
+
+void AllocationScope::onAllocation(size_t _size)
+{
+    auto scope = t_currentScope;
+    if (scope)
+    {
+        scope->m_counts.count++;
+        scope->m_counts.bytes += _size;
+    }
+}
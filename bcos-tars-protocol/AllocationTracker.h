@@ -0,0 +1,161 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief attribute the heap allocations to the protocol operations
+ * @file AllocationTracker.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace bcostars
+{
+struct AllocationCounts
+{
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+};
+
+struct AllocationSiteSnapshot
+{
+    std::string name;
+    // the sampled executions of the site and the allocations made by them
+    uint64_t scopes = 0;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+// the allocations of one operation, e.g. BlockImpl::decode, including the nested operations
+class AllocationSite
+{
+public:
+    explicit AllocationSite(std::string _name) : m_name(std::move(_name)) {}
+
+    std::string const& name() const { return m_name; }
+
+    // whether the current execution is tracked, one in every sample rate executions is
+    bool sample(uint64_t _sampleRate)
+    {
+        return _sampleRate <= 1 ||
+               m_entries.fetch_add(1, std::memory_order_relaxed) % _sampleRate == 0;
+    }
+    void record(AllocationCounts const& _counts)
+    {
+        m_scopes.fetch_add(1, std::memory_order_relaxed);
+        m_allocations.fetch_add(_counts.count, std::memory_order_relaxed);
+        m_bytes.fetch_add(_counts.bytes, std::memory_order_relaxed);
+    }
+
+    AllocationSiteSnapshot snapshot() const;
+    void reset();
+
+private:
+    std::string m_name;
+    std::atomic<uint64_t> m_entries = {0};
+    std::atomic<uint64_t> m_scopes = {0};
+    std::atomic<uint64_t> m_allocations = {0};
+    std::atomic<uint64_t> m_bytes = {0};
+};
+
+// process-wide registry of the allocation sites
+class AllocationSites
+{
+public:
+    static AllocationSites& instance()
+    {
+        static AllocationSites s_instance;
+        return s_instance;
+    }
+
+    // the returned reference is valid until the process exits
+    AllocationSite& site(std::string const& _name);
+
+    // track one in every _sampleRate executions of every site, 1 tracks all of them, so the
+    // production canaries may keep the overhead low
+    void setSampleRate(uint64_t _sampleRate) { m_sampleRate = _sampleRate > 0 ? _sampleRate : 1; }
+    uint64_t sampleRate() const { return m_sampleRate.load(std::memory_order_relaxed); }
+
+    std::vector<AllocationSiteSnapshot> snapshot() const;
+    // dump all the sites in the prometheus text exposition format
+    std::string toPrometheusText() const;
+    void reset();
+
+private:
+    AllocationSites() = default;
+
+    std::atomic<uint64_t> m_sampleRate = {1};
+    mutable std::mutex x_sites;
+    std::map<std::string, std::unique_ptr<AllocationSite>> m_sites;
+};
+
+// attributes the allocations of the current thread to the site until destroyed, the scopes nest
+// and the allocations of the inner scopes are counted by the outer ones as well
+class AllocationScope
+{
+public:
+    explicit AllocationScope(AllocationSite& _site);
+    ~AllocationScope();
+
+    AllocationScope(AllocationScope const&) = delete;
+    AllocationScope& operator=(AllocationScope const&) = delete;
+
+    // called by the replaced operator new for the innermost scope of the thread
+    static void onAllocation(size_t _size);
+
+private:
+    AllocationSite* m_site = nullptr;
+    AllocationScope* m_parent = nullptr;
+    AllocationCounts m_counts;
+};
+
+// whether the global operator new is replaced by the counting one, which is decided at build
+// time by the ALLOCATION_TRACKING option
+constexpr bool allocationTrackingEnabled()
+{
+#ifdef BCOS_TARS_ALLOCATION_TRACKING
+    return true;
+#else
+    return false;
+#endif
+}
+
+// the allocations of all the threads since the process started, always zero if the tracking is
+// disabled
+AllocationCounts allocationTotals();
+}  // namespace bcostars
+
+#define BCOS_TARS_ALLOC_CONCAT_IMPL(_a, _b) _a##_b
+#define BCOS_TARS_ALLOC_CONCAT(_a, _b) BCOS_TARS_ALLOC_CONCAT_IMPL(_a, _b)
+
+// attributes the allocations until the end of the enclosing block to the site _name, the site is
+// looked up only once per call site, and the macro expands to nothing if the tracking is disabled
+#ifdef BCOS_TARS_ALLOCATION_TRACKING
+#define BCOS_TARS_ALLOC_SCOPE(_name)                                                           \
+    bcostars::AllocationScope BCOS_TARS_ALLOC_CONCAT(_allocationScope, __LINE__)(              \
+        []() -> bcostars::AllocationSite& {                                                    \
+            static bcostars::AllocationSite& s_site =                                          \
+                bcostars::AllocationSites::instance().site(_name);                             \
+            return s_site;                                                                     \
+        }())
+#else
+#define BCOS_TARS_ALLOC_SCOPE(_name)
+#endif
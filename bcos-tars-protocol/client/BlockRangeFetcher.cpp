@@ -0,0 +1,141 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief fetch a range of blocks in pipelined chunks
+ * @file BlockRangeFetcher.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "BlockRangeFetcher.h"
+#include <algorithm>
+#include <vector>
+
+using namespace bcostars;
+
+BlockRangeFetcher::BlockRangeFetcher(RequestChunk _requestChunk, int64_t _startNumber,
+    int64_t _count, int64_t _chunkSize, size_t _maxInflightChunks,
+    std::function<void(std::shared_ptr<BlockList>)> _onChunk,
+    std::function<void(bcos::Error::Ptr, int64_t)> _onFinished)
+  : m_requestChunk(std::move(_requestChunk)),
+    m_startNumber(_startNumber),
+    m_count(std::max<int64_t>(_count, 0)),
+    m_chunkSize(std::max<int64_t>(_chunkSize, 1)),
+    m_maxInflightChunks(std::max<size_t>(_maxInflightChunks, 1)),
+    m_onChunk(std::move(_onChunk)),
+    m_onFinished(std::move(_onFinished))
+{
+    m_totalChunks = (m_count + m_chunkSize - 1) / m_chunkSize;
+}
+
+void BlockRangeFetcher::start()
+{
+    if (m_totalChunks == 0)
+    {
+        m_finished = true;
+        m_onFinished(nullptr, 0);
+        return;
+    }
+    requestChunks();
+}
+
+int64_t BlockRangeFetcher::chunkCount(uint64_t _index) const
+{
+    return std::min(m_chunkSize, m_count - (int64_t)_index * m_chunkSize);
+}
+
+void BlockRangeFetcher::requestChunks()
+{
+    std::vector<uint64_t> indexes;
+    {
+        std::lock_guard<std::mutex> lock(x_state);
+        // the responded but undelivered chunks are counted too, to bound the buffered blocks
+        while (!m_finished && m_nextRequestIndex < m_totalChunks &&
+               m_nextRequestIndex - m_nextDeliverIndex < m_maxInflightChunks)
+        {
+            indexes.push_back(m_nextRequestIndex++);
+        }
+    }
+    // Note: request without the lock, the response may be called back in the current thread
+    for (auto index : indexes)
+    {
+        auto requestedCount = chunkCount(index);
+        m_requestChunk(m_startNumber + (int64_t)index * m_chunkSize, requestedCount,
+            [self = shared_from_this(), index, requestedCount](
+                bcos::Error::Ptr _error, std::shared_ptr<BlockList> _blocks) {
+                self->onChunk(index, requestedCount, std::move(_error), std::move(_blocks));
+            });
+    }
+}
+
+void BlockRangeFetcher::onChunk(uint64_t _index, int64_t _requestedCount, bcos::Error::Ptr _error,
+    std::shared_ptr<BlockList> _blocks)
+{
+    bcos::Error::Ptr finishError;
+    bool finished = false;
+    {
+        std::unique_lock<std::mutex> lock(x_state);
+        if (m_finished)
+        {
+            return;
+        }
+        m_arrivedChunks[_index] = Chunk{std::move(_error), std::move(_blocks), _requestedCount};
+        // another thread is delivering, it will deliver this chunk in order
+        if (m_delivering)
+        {
+            return;
+        }
+        m_delivering = true;
+        while (!finished)
+        {
+            auto it = m_arrivedChunks.find(m_nextDeliverIndex);
+            if (it == m_arrivedChunks.end())
+            {
+                break;
+            }
+            auto chunk = std::move(it->second);
+            m_arrivedChunks.erase(it);
+            m_nextDeliverIndex++;
+            if (chunk.error)
+            {
+                finishError = std::move(chunk.error);
+                finished = true;
+                break;
+            }
+            auto deliveredCount = chunk.blocks ? (int64_t)chunk.blocks->size() : 0;
+            m_fetchedCount += deliveredCount;
+            // the whole range is delivered, or the latest block is reached
+            finished = (deliveredCount < chunk.requestedCount) ||
+                       (m_nextDeliverIndex == m_totalChunks);
+            if (deliveredCount > 0)
+            {
+                lock.unlock();
+                m_onChunk(std::move(chunk.blocks));
+                lock.lock();
+            }
+        }
+        m_delivering = false;
+        if (finished)
+        {
+            m_finished = true;
+            m_arrivedChunks.clear();
+        }
+    }
+    if (finished)
+    {
+        m_onFinished(std::move(finishError), m_fetchedCount);
+        return;
+    }
+    requestChunks();
+}
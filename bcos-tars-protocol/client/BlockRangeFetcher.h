@@ -0,0 +1,83 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief fetch a range of blocks in pipelined chunks
+ * @file BlockRangeFetcher.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <bcos-framework/interfaces/protocol/Block.h>
+#include <bcos-framework/libutilities/Error.h>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace bcostars
+{
+// requests the chunks of the range with a bounded number of undelivered chunks, and delivers
+// the responded chunks in order; a chunk with fewer blocks than requested means the latest block
+// is reached, the chunks after it are dropped
+class BlockRangeFetcher : public std::enable_shared_from_this<BlockRangeFetcher>
+{
+public:
+    using Ptr = std::shared_ptr<BlockRangeFetcher>;
+    using BlockList = std::vector<bcos::protocol::Block::Ptr>;
+    using ChunkCallback = std::function<void(bcos::Error::Ptr, std::shared_ptr<BlockList>)>;
+    // request the blocks [_startNumber, _startNumber + _count)
+    using RequestChunk =
+        std::function<void(int64_t _startNumber, int64_t _count, ChunkCallback _callback)>;
+
+    BlockRangeFetcher(RequestChunk _requestChunk, int64_t _startNumber, int64_t _count,
+        int64_t _chunkSize, size_t _maxInflightChunks,
+        std::function<void(std::shared_ptr<BlockList>)> _onChunk,
+        std::function<void(bcos::Error::Ptr, int64_t)> _onFinished);
+
+    void start();
+
+private:
+    struct Chunk
+    {
+        bcos::Error::Ptr error;
+        std::shared_ptr<BlockList> blocks;
+        int64_t requestedCount;
+    };
+
+    void requestChunks();
+    void onChunk(uint64_t _index, int64_t _requestedCount, bcos::Error::Ptr _error,
+        std::shared_ptr<BlockList> _blocks);
+    int64_t chunkCount(uint64_t _index) const;
+
+    RequestChunk m_requestChunk;
+    int64_t m_startNumber;
+    int64_t m_count;
+    int64_t m_chunkSize;
+    size_t m_maxInflightChunks;
+    std::function<void(std::shared_ptr<BlockList>)> m_onChunk;
+    std::function<void(bcos::Error::Ptr, int64_t)> m_onFinished;
+
+    std::mutex x_state;
+    uint64_t m_totalChunks;
+    uint64_t m_nextRequestIndex = 0;
+    uint64_t m_nextDeliverIndex = 0;
+    // the responded chunks waiting for the chunks before them
+    std::map<uint64_t, Chunk> m_arrivedChunks;
+    bool m_delivering = false;
+    bool m_finished = false;
+    int64_t m_fetchedCount = 0;
+};
+}  // namespace bcostars
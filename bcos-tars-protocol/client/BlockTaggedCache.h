@@ -0,0 +1,120 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief cache of the values which only change when a block is committed
+ * @file BlockTaggedCache.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/client/LRUCache.h"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace bcostars
+{
+// every value is tagged with the latest block number observed when it was queried, and is
+// valid until a newer block number is observed; nothing is cached before any block is observed
+template <typename Value>
+class BlockTaggedCache
+{
+public:
+    static constexpr int64_t c_unknownBlockNumber = -1;
+
+    bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+    void setEnabled(bool _enabled)
+    {
+        m_enabled.store(_enabled, std::memory_order_relaxed);
+        if (!_enabled)
+        {
+            std::lock_guard<std::mutex> lock(x_values);
+            m_values.clear();
+        }
+    }
+
+    int64_t latestBlockNumber() const
+    {
+        return m_latestBlockNumber.load(std::memory_order_acquire);
+    }
+    // returns true if the block number is newer than the observed one
+    bool notifyBlockNumber(int64_t _blockNumber)
+    {
+        auto latest = m_latestBlockNumber.load(std::memory_order_relaxed);
+        while (_blockNumber > latest)
+        {
+            if (m_latestBlockNumber.compare_exchange_weak(
+                    latest, _blockNumber, std::memory_order_acq_rel))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::optional<Value> get(std::string const& _key)
+    {
+        auto latest = latestBlockNumber();
+        std::lock_guard<std::mutex> lock(x_values);
+        auto it = m_values.find(_key);
+        if (it == m_values.end() || it->second.blockNumber != latest)
+        {
+            m_misses++;
+            return std::nullopt;
+        }
+        m_hits++;
+        return it->second.value;
+    }
+
+    // _blockNumber must be the latestBlockNumber() loaded before sending the query, so the value
+    // is never tagged with a block newer than the one it is read from
+    void put(std::string const& _key, Value _value, int64_t _blockNumber)
+    {
+        if (_blockNumber == c_unknownBlockNumber || _blockNumber != latestBlockNumber())
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(x_values);
+        m_values[_key] = Entry{std::move(_value), _blockNumber};
+    }
+
+    CacheStats stats() const
+    {
+        std::lock_guard<std::mutex> lock(x_values);
+        CacheStats stats;
+        stats.hits = m_hits;
+        stats.misses = m_misses;
+        stats.entries = m_values.size();
+        return stats;
+    }
+
+private:
+    struct Entry
+    {
+        Value value;
+        int64_t blockNumber;
+    };
+
+    std::atomic_bool m_enabled = {false};
+    std::atomic<int64_t> m_latestBlockNumber = {c_unknownBlockNumber};
+    mutable std::mutex x_values;
+    std::map<std::string, Entry> m_values;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+};
+}  // namespace bcostars
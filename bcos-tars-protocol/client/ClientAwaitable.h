@@ -0,0 +1,165 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief co_await the callback based methods of the service clients
+ * @file ClientAwaitable.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define BCOS_TARS_COROUTINE 1
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+
+namespace bcostars
+{
+// resumes the coroutine once the call is responded
+class ClientExecutor
+{
+public:
+    virtual ~ClientExecutor() = default;
+    virtual void execute(std::coroutine_handle<> _handle) = 0;
+};
+
+// resumes on the thread calling back, which is the tars async callback thread for the responses
+class InlineClientExecutor : public ClientExecutor
+{
+public:
+    void execute(std::coroutine_handle<> _handle) override { _handle.resume(); }
+};
+
+inline ClientExecutor& inlineClientExecutor()
+{
+    static InlineClientExecutor s_executor;
+    return s_executor;
+}
+
+namespace detail
+{
+template <typename Method>
+struct ClientMethodTraits;
+// the callback is the last parameter of the client methods
+template <typename Client, typename... Params>
+struct ClientMethodTraits<void (Client::*)(Params...)>
+{
+    using Callback =
+        std::decay_t<std::tuple_element_t<sizeof...(Params) - 1, std::tuple<Params...>>>;
+};
+
+template <typename Callback>
+struct ClientCallbackResults;
+template <typename... Results>
+struct ClientCallbackResults<std::function<void(Results...)>>
+{
+    using Tuple = std::tuple<std::decay_t<Results>...>;
+};
+}  // namespace detail
+
+// the awaitable of one client call, the call is issued when awaited and the results are stored in
+// the awaitable, so nothing is allocated besides the coroutine frame and what the client itself
+// allocates; co_await returns the only result, or the tuple of the results
+template <typename Client, typename Method, typename... Args>
+class ClientCall
+{
+public:
+    using Callback = typename detail::ClientMethodTraits<Method>::Callback;
+    using Results = typename detail::ClientCallbackResults<Callback>::Tuple;
+
+    ClientCall(ClientExecutor& _executor, Client& _client, Method _method, Args... _args)
+      : m_executor(&_executor), m_client(_client), m_method(_method), m_args(std::move(_args)...)
+    {}
+    ClientCall(ClientCall const&) = delete;
+    ClientCall& operator=(ClientCall const&) = delete;
+
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> _handle)
+    {
+        m_handle = _handle;
+        std::apply(
+            [this](auto&... _args) {
+                (m_client.*m_method)(std::move(_args)..., Callback([this](auto&&... _results) {
+                    m_results.emplace(std::forward<decltype(_results)>(_results)...);
+                    // the later one of the response and the suspension resumes the coroutine
+                    if (m_completed.exchange(true, std::memory_order_acq_rel))
+                    {
+                        m_executor->execute(m_handle);
+                    }
+                }));
+            },
+            m_args);
+        // responded synchronously, e.g. by the cache, resume at once
+        return !m_completed.exchange(true, std::memory_order_acq_rel);
+    }
+    auto await_resume()
+    {
+        if constexpr (std::tuple_size_v<Results> == 1)
+        {
+            return std::get<0>(std::move(*m_results));
+        }
+        else
+        {
+            return std::move(*m_results);
+        }
+    }
+
+private:
+    ClientExecutor* m_executor;
+    Client& m_client;
+    Method m_method;
+    std::tuple<Args...> m_args;
+    std::coroutine_handle<> m_handle;
+    std::atomic_bool m_completed = {false};
+    std::optional<Results> m_results;
+};
+
+// co_await callAsync(*ledgerClient, &LedgerServiceClient::asyncGetBlockNumber), the callback
+// parameter is omitted and the other parameters are copied into the awaitable
+template <typename Client, typename Method, typename... Args>
+ClientCall<Client, Method, std::decay_t<Args>...> callAsync(
+    Client& _client, Method _method, Args&&... _args)
+{
+    return ClientCall<Client, Method, std::decay_t<Args>...>(
+        inlineClientExecutor(), _client, _method, std::forward<Args>(_args)...);
+}
+
+// the same as callAsync, and the coroutine is resumed on _executor
+template <typename Client, typename Method, typename... Args>
+ClientCall<Client, Method, std::decay_t<Args>...> callAsyncVia(
+    ClientExecutor& _executor, Client& _client, Method _method, Args&&... _args)
+{
+    return ClientCall<Client, Method, std::decay_t<Args>...>(
+        _executor, _client, _method, std::forward<Args>(_args)...);
+}
+
+// the fire-and-forget coroutine, the frame is destroyed once the coroutine returns
+struct DetachedClientTask
+{
+    struct promise_type
+    {
+        DetachedClientTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+}  // namespace bcostars
+#endif
@@ -0,0 +1,195 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief per-method call metrics for the tars service clients
+ * @file ClientMetrics.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "ClientMetrics.h"
+#include <sstream>
+
+using namespace bcostars;
+
+uint64_t LatencyHistogram::Snapshot::quantile(double _quantile) const
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+    auto rank = (uint64_t)(_quantile * (double)count);
+    rank = std::max<uint64_t>(1, std::min(rank, count));
+    uint64_t cumulative = 0;
+    for (uint32_t i = 0; i < c_bucketCount; ++i)
+    {
+        cumulative += buckets[i];
+        if (cumulative >= rank)
+        {
+            return std::min(bucketUpperBound(i), max);
+        }
+    }
+    return max;
+}
+
+uint64_t LatencyHistogram::Snapshot::cumulativeCount(uint64_t _value) const
+{
+    uint64_t cumulative = 0;
+    for (uint32_t i = 0; i < c_bucketCount; ++i)
+    {
+        if (bucketUpperBound(i) > _value + 1)
+        {
+            break;
+        }
+        cumulative += buckets[i];
+    }
+    return cumulative;
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const
+{
+    Snapshot snapshot;
+    for (uint32_t i = 0; i < c_bucketCount; ++i)
+    {
+        snapshot.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+        snapshot.count += snapshot.buckets[i];
+    }
+    snapshot.sum = m_sum.load(std::memory_order_relaxed);
+    snapshot.max = m_max.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void LatencyHistogram::reset()
+{
+    for (auto& bucket : m_buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+MethodMetricsSnapshot MethodMetrics::snapshot() const
+{
+    MethodMetricsSnapshot snapshot;
+    snapshot.service = m_service;
+    snapshot.method = m_method;
+    snapshot.calls = m_calls.load(std::memory_order_relaxed);
+    snapshot.errors = m_errors.load(std::memory_order_relaxed);
+    snapshot.inFlight = m_inFlight.load(std::memory_order_relaxed);
+    snapshot.requestBytes = m_requestBytes.load(std::memory_order_relaxed);
+    snapshot.responseBytes = m_responseBytes.load(std::memory_order_relaxed);
+    snapshot.responseMeasured = m_responseMeasured.load(std::memory_order_relaxed);
+    snapshot.latency = m_latency.snapshot();
+    return snapshot;
+}
+
+void MethodMetrics::reset()
+{
+    m_calls.store(0, std::memory_order_relaxed);
+    m_errors.store(0, std::memory_order_relaxed);
+    m_requestBytes.store(0, std::memory_order_relaxed);
+    m_responseBytes.store(0, std::memory_order_relaxed);
+    m_latency.reset();
+    // Note: the in-flight gauge is not reset, the pending responses will decrease it
+}
+
+MethodMetrics& ClientMetrics::method(std::string const& _service, std::string const& _method)
+{
+    std::lock_guard<std::mutex> lock(x_methods);
+    auto& metrics = m_methods[std::make_pair(_service, _method)];
+    if (!metrics)
+    {
+        metrics = std::make_unique<MethodMetrics>(_service, _method);
+    }
+    return *metrics;
+}
+
+std::vector<MethodMetricsSnapshot> ClientMetrics::snapshot() const
+{
+    std::vector<MethodMetricsSnapshot> snapshots;
+    std::lock_guard<std::mutex> lock(x_methods);
+    snapshots.reserve(m_methods.size());
+    for (auto const& it : m_methods)
+    {
+        snapshots.emplace_back(it.second->snapshot());
+    }
+    return snapshots;
+}
+
+void ClientMetrics::reset()
+{
+    std::lock_guard<std::mutex> lock(x_methods);
+    for (auto const& it : m_methods)
+    {
+        it.second->reset();
+    }
+}
+
+std::string ClientMetrics::toPrometheusText() const
+{
+    // the exported histogram buckets: 16us, 64us, ... , about 67s
+    static const std::vector<uint64_t> c_exportedBuckets = {16, 64, 256, 1024, 4096, 16384, 65536,
+        262144, 1048576, 4194304, 16777216, 67108864};
+
+    auto snapshots = snapshot();
+    std::stringstream output;
+    auto labels = [](MethodMetricsSnapshot const& _snapshot) {
+        return "service=\"" + _snapshot.service + "\",method=\"" + _snapshot.method + "\"";
+    };
+    // _measured filters out the methods without the metric
+    auto writeMetric = [&](std::string const& _name, std::string const& _type,
+                           std::string const& _help, auto _getter,
+                           bool (*_measured)(MethodMetricsSnapshot const&) = nullptr) {
+        output << "# HELP " << _name << " " << _help << "\n";
+        output << "# TYPE " << _name << " " << _type << "\n";
+        for (auto const& it : snapshots)
+        {
+            if (_measured && !_measured(it))
+            {
+                continue;
+            }
+            output << _name << "{" << labels(it) << "} " << _getter(it) << "\n";
+        }
+    };
+    writeMetric("bcos_client_calls_total", "counter", "Total requests sent by the service clients",
+        [](MethodMetricsSnapshot const& _snapshot) { return _snapshot.calls; });
+    writeMetric("bcos_client_errors_total", "counter", "Total requests responded with error",
+        [](MethodMetricsSnapshot const& _snapshot) { return _snapshot.errors; });
+    writeMetric("bcos_client_in_flight", "gauge", "Requests waiting for the response",
+        [](MethodMetricsSnapshot const& _snapshot) { return _snapshot.inFlight; });
+    writeMetric("bcos_client_request_bytes_total", "counter", "Total request payload bytes",
+        [](MethodMetricsSnapshot const& _snapshot) { return _snapshot.requestBytes; });
+    writeMetric("bcos_client_response_bytes_total", "counter", "Total response payload bytes",
+        [](MethodMetricsSnapshot const& _snapshot) { return _snapshot.responseBytes; },
+        [](MethodMetricsSnapshot const& _snapshot) { return _snapshot.responseMeasured; });
+
+    std::string latencyName = "bcos_client_latency_us";
+    output << "# HELP " << latencyName << " Response latency of the service clients\n";
+    output << "# TYPE " << latencyName << " histogram\n";
+    for (auto const& it : snapshots)
+    {
+        for (auto bound : c_exportedBuckets)
+        {
+            output << latencyName << "_bucket{" << labels(it) << ",le=\"" << bound << "\"} "
+                   << it.latency.cumulativeCount(bound) << "\n";
+        }
+        output << latencyName << "_bucket{" << labels(it) << ",le=\"+Inf\"} " << it.latency.count
+               << "\n";
+        output << latencyName << "_sum{" << labels(it) << "} " << it.latency.sum << "\n";
+        output << latencyName << "_count{" << labels(it) << "} " << it.latency.count << "\n";
+    }
+    return output.str();
+}
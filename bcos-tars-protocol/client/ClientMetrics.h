@@ -0,0 +1,292 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief per-method call metrics for the tars service clients
+ * @file ClientMetrics.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/AllocationTracker.h"
+#include <bcos-framework/libutilities/Common.h>
+#include <bcos-framework/libutilities/Error.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace bcostars
+{
+// log-linear (HDR style) latency histogram in microseconds, every power of two is split into
+// 2^c_subBucketBits linear sub-buckets, so the relative error of a bucket is at most 12.5%
+class LatencyHistogram
+{
+public:
+    static constexpr uint32_t c_subBucketBits = 3;
+    static constexpr uint32_t c_subBucketCount = 1 << c_subBucketBits;
+    // values over 2^c_maxMagnitude us (about 12 days) are clamped into the last bucket
+    static constexpr uint32_t c_maxMagnitude = 40;
+    static constexpr uint32_t c_bucketCount =
+        (c_maxMagnitude - c_subBucketBits + 1) * c_subBucketCount;
+
+    struct Snapshot
+    {
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+        std::array<uint64_t, c_bucketCount> buckets{};
+
+        // the upper bound of the bucket containing the _quantile (0~1) sample
+        uint64_t quantile(double _quantile) const;
+        // the number of samples less than or equal to _value
+        uint64_t cumulativeCount(uint64_t _value) const;
+    };
+
+    void record(uint64_t _valueUs)
+    {
+        m_buckets[bucketIndex(_valueUs)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(_valueUs, std::memory_order_relaxed);
+        auto max = m_max.load(std::memory_order_relaxed);
+        while (_valueUs > max &&
+               !m_max.compare_exchange_weak(max, _valueUs, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    Snapshot snapshot() const;
+    void reset();
+
+    static uint32_t bucketIndex(uint64_t _value)
+    {
+        if (_value < c_subBucketCount)
+        {
+            return (uint32_t)_value;
+        }
+        uint32_t magnitude = 63 - __builtin_clzll(_value);
+        if (magnitude >= c_maxMagnitude)
+        {
+            return c_bucketCount - 1;
+        }
+        auto shift = magnitude - c_subBucketBits;
+        auto subBucket = (uint32_t)(_value >> shift) & (c_subBucketCount - 1);
+        return (magnitude - c_subBucketBits + 1) * c_subBucketCount + subBucket;
+    }
+    // the exclusive upper bound of the values recorded into the given bucket
+    static uint64_t bucketUpperBound(uint32_t _index)
+    {
+        if (_index < c_subBucketCount)
+        {
+            return _index + 1;
+        }
+        auto magnitude = _index / c_subBucketCount + c_subBucketBits - 1;
+        auto subBucket = _index % c_subBucketCount;
+        auto shift = magnitude - c_subBucketBits;
+        return ((uint64_t)(c_subBucketCount + subBucket + 1)) << shift;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, c_bucketCount> m_buckets{};
+    std::atomic<uint64_t> m_count = {0};
+    std::atomic<uint64_t> m_sum = {0};
+    std::atomic<uint64_t> m_max = {0};
+};
+
+struct MethodMetricsSnapshot
+{
+    std::string service;
+    std::string method;
+    uint64_t calls = 0;
+    uint64_t errors = 0;
+    int64_t inFlight = 0;
+    uint64_t requestBytes = 0;
+    // only the responses carrying the bytes are measured, responseMeasured is false otherwise
+    uint64_t responseBytes = 0;
+    bool responseMeasured = false;
+    LatencyHistogram::Snapshot latency;
+};
+
+// the metrics of one client method, all counters are updated with relaxed atomics
+class MethodMetrics
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    MethodMetrics(std::string _service, std::string _method)
+      : m_service(std::move(_service)),
+        m_method(std::move(_method)),
+        m_callbackAllocations(
+            AllocationSites::instance().site(m_service + "." + m_method + ".callback"))
+    {}
+
+    std::string const& service() const { return m_service; }
+    std::string const& method() const { return m_method; }
+    // the allocations of the response callbacks, counted if the allocation tracking is enabled
+    AllocationSite& callbackAllocations() { return m_callbackAllocations; }
+
+    // the request expects a response, must be paired with onResponse
+    void onRequest(size_t _requestBytes)
+    {
+        m_calls.fetch_add(1, std::memory_order_relaxed);
+        m_inFlight.fetch_add(1, std::memory_order_relaxed);
+        m_requestBytes.fetch_add(_requestBytes, std::memory_order_relaxed);
+    }
+    // the request is sent without waiting for any response
+    void onOneWayRequest(size_t _requestBytes)
+    {
+        m_calls.fetch_add(1, std::memory_order_relaxed);
+        m_requestBytes.fetch_add(_requestBytes, std::memory_order_relaxed);
+    }
+    // the response size is unknown, e.g. the response is decoded into the protocol objects
+    void onResponse(Clock::time_point _startTime, bool _error)
+    {
+        auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - _startTime);
+        m_latency.record(elapsed.count() > 0 ? elapsed.count() : 0);
+        m_inFlight.fetch_sub(1, std::memory_order_relaxed);
+        if (_error)
+        {
+            m_errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    void onResponse(Clock::time_point _startTime, bool _error, size_t _responseBytes)
+    {
+        onResponse(_startTime, _error);
+        m_responseBytes.fetch_add(_responseBytes, std::memory_order_relaxed);
+        // avoid writing the shared flag on every response
+        if (!m_responseMeasured.load(std::memory_order_relaxed))
+        {
+            m_responseMeasured.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    MethodMetricsSnapshot snapshot() const;
+    void reset();
+
+private:
+    std::string m_service;
+    std::string m_method;
+    std::atomic<uint64_t> m_calls = {0};
+    std::atomic<uint64_t> m_errors = {0};
+    std::atomic<int64_t> m_inFlight = {0};
+    std::atomic<uint64_t> m_requestBytes = {0};
+    std::atomic<uint64_t> m_responseBytes = {0};
+    std::atomic_bool m_responseMeasured = {false};
+    LatencyHistogram m_latency;
+    AllocationSite& m_callbackAllocations;
+};
+
+// process-wide registry of the client method metrics
+class ClientMetrics
+{
+public:
+    static ClientMetrics& instance()
+    {
+        static ClientMetrics s_instance;
+        return s_instance;
+    }
+
+    // the returned reference is valid until the process exits
+    MethodMetrics& method(std::string const& _service, std::string const& _method);
+
+    std::vector<MethodMetricsSnapshot> snapshot() const;
+    // dump all the metrics in the prometheus text exposition format
+    std::string toPrometheusText() const;
+    void reset();
+
+private:
+    ClientMetrics() = default;
+
+    mutable std::mutex x_methods;
+    std::map<std::pair<std::string, std::string>, std::unique_ptr<MethodMetrics>> m_methods;
+};
+
+namespace detail
+{
+inline size_t payloadSize(bcos::bytesConstRef _data)
+{
+    return _data.size();
+}
+inline size_t payloadSize(bcos::bytes const& _data)
+{
+    return _data.size();
+}
+inline size_t payloadSize(bcos::bytesPointer const& _data)
+{
+    return _data ? _data->size() : 0;
+}
+// the other arguments of the response are not counted
+template <typename T>
+inline size_t payloadSize(T const&)
+{
+    return 0;
+}
+// the response arguments whose size is measured by payloadSize
+template <typename T>
+constexpr bool c_isPayload = std::is_same_v<T, bcos::bytesConstRef> ||
+                             std::is_same_v<T, bcos::bytes> ||
+                             std::is_same_v<T, bcos::bytesPointer>;
+
+template <typename... Args>
+inline bool hasError(bcos::Error::Ptr const& _error, Args const&...)
+{
+    return _error != nullptr;
+}
+}  // namespace detail
+
+// wrap the response callback of a client method to record its calls, errors, in-flight requests,
+// payload bytes and latency; the response bytes are recorded only if the callback receives bytes,
+// the responses decoded into other objects are not measured; a null callback means a one-way
+// request and keeps null
+template <typename Func>
+Func instrumentCallback(MethodMetrics& _metrics, Func _callback, size_t _requestBytes = 0)
+{
+    if (!_callback)
+    {
+        _metrics.onOneWayRequest(_requestBytes);
+        return _callback;
+    }
+    _metrics.onRequest(_requestBytes);
+    return [&_metrics, startTime = MethodMetrics::Clock::now(), callback = std::move(_callback)](
+               auto&&... _args) {
+        if constexpr ((detail::c_isPayload<std::decay_t<decltype(_args)>> || ... || false))
+        {
+            _metrics.onResponse(startTime, detail::hasError(_args...),
+                (detail::payloadSize(_args) + ... + 0));
+        }
+        else
+        {
+            _metrics.onResponse(startTime, detail::hasError(_args...));
+        }
+#ifdef BCOS_TARS_ALLOCATION_TRACKING
+        AllocationScope allocationScope(_metrics.callbackAllocations());
+#endif
+        callback(std::forward<decltype(_args)>(_args)...);
+    };
+}
+}  // namespace bcostars
+
+// the MethodMetrics of the calling client method, looked up only once per call site
+#define BCOS_CLIENT_METRICS(_service, _method)                                 \
+    ([]() -> bcostars::MethodMetrics& {                                        \
+        static bcostars::MethodMetrics& s_metrics =                            \
+            bcostars::ClientMetrics::instance().method((_service), (_method)); \
+        return s_metrics;                                                      \
+    }())
@@ -0,0 +1,164 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief sampled trace context propagated through the tars service clients
+ * @file ClientTrace.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "ClientTrace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+using namespace bcostars;
+
+namespace
+{
+int64_t nowInMicroseconds()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+uint64_t generateID()
+{
+    thread_local std::mt19937_64 s_generator(
+        std::random_device{}() ^ std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    uint64_t id = 0;
+    while (id == 0)
+    {
+        id = s_generator();
+    }
+    return id;
+}
+
+std::string toHex(uint64_t _value)
+{
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)_value);
+    return std::string(buffer, 16);
+}
+
+uint64_t fromHex(std::string const& _value)
+{
+    return std::strtoull(_value.c_str(), nullptr, 16);
+}
+}  // namespace
+
+TraceContext TraceContext::fromTarsContext(std::map<std::string, std::string> const& _context)
+{
+    TraceContext context;
+    auto traceIt = _context.find(c_traceIDKey);
+    auto spanIt = _context.find(c_spanIDKey);
+    if (traceIt != _context.end() && spanIt != _context.end())
+    {
+        context.traceID = fromHex(traceIt->second);
+        context.spanID = fromHex(spanIt->second);
+    }
+    return context;
+}
+
+void TraceContext::toTarsContext(std::map<std::string, std::string>& _context) const
+{
+    _context[c_traceIDKey] = toHex(traceID);
+    _context[c_spanIDKey] = toHex(spanID);
+}
+
+void InMemorySpanExporter::exportSpan(TraceSpan&& _span)
+{
+    std::lock_guard<std::mutex> lock(x_spans);
+    m_spans.emplace_back(std::move(_span));
+    while (m_spans.size() > m_capacity)
+    {
+        m_spans.pop_front();
+    }
+}
+
+std::vector<TraceSpan> InMemorySpanExporter::spans() const
+{
+    std::lock_guard<std::mutex> lock(x_spans);
+    return std::vector<TraceSpan>(m_spans.begin(), m_spans.end());
+}
+
+std::vector<TraceSpan> InMemorySpanExporter::trace(uint64_t _traceID) const
+{
+    std::vector<TraceSpan> result;
+    {
+        std::lock_guard<std::mutex> lock(x_spans);
+        for (auto const& span : m_spans)
+        {
+            if (span.traceID == _traceID)
+            {
+                result.push_back(span);
+            }
+        }
+    }
+    std::stable_sort(result.begin(), result.end(), [](TraceSpan const& _a, TraceSpan const& _b) {
+        return _a.startTime < _b.startTime;
+    });
+    return result;
+}
+
+size_t InMemorySpanExporter::size() const
+{
+    std::lock_guard<std::mutex> lock(x_spans);
+    return m_spans.size();
+}
+
+void InMemorySpanExporter::clear()
+{
+    std::lock_guard<std::mutex> lock(x_spans);
+    m_spans.clear();
+}
+
+void ClientSpan::finish(State& _state, bool _error)
+{
+    _state.span.endTime = nowInMicroseconds();
+    _state.span.error = _error;
+    ClientTracer::instance().exportSpan(TraceSpan(_state.span));
+}
+
+ClientSpan ClientTracer::startSampledSpan(
+    TraceContext const& _parent, const char* _service, const char* _method)
+{
+    auto state = std::make_shared<ClientSpan::State>();
+    auto& span = state->span;
+    span.traceID = _parent.sampled() ? _parent.traceID : generateID();
+    span.parentSpanID = _parent.sampled() ? _parent.spanID : 0;
+    span.spanID = generateID();
+    span.service = _service;
+    span.method = _method;
+    span.startTime = nowInMicroseconds();
+    TraceContext{span.traceID, span.spanID}.toTarsContext(state->tarsContext);
+    return ClientSpan(std::move(state));
+}
+
+void ClientTracer::exportSpan(TraceSpan&& _span)
+{
+    SpanExporter::Ptr exporter;
+    {
+        std::lock_guard<std::mutex> lock(x_exporter);
+        exporter = m_exporter;
+    }
+    if (exporter)
+    {
+        exporter->exportSpan(std::move(_span));
+    }
+}
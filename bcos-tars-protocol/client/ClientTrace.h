@@ -0,0 +1,223 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief sampled trace context propagated through the tars service clients
+ * @file ClientTrace.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/client/ClientMetrics.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace bcostars
+{
+// the trace context carried by the tars request context, a zero traceID means not sampled
+struct TraceContext
+{
+    // keys of the tars request context
+    static constexpr const char* c_traceIDKey = "bcos_trace_id";
+    static constexpr const char* c_spanIDKey = "bcos_span_id";
+
+    uint64_t traceID = 0;
+    uint64_t spanID = 0;
+
+    bool sampled() const { return traceID != 0; }
+
+    // extract the trace context from the request context received by the servant
+    static TraceContext fromTarsContext(std::map<std::string, std::string> const& _context);
+    void toTarsContext(std::map<std::string, std::string>& _context) const;
+};
+
+// one client hop, the timestamps are microseconds since epoch so hops of different processes
+// can be ordered
+struct TraceSpan
+{
+    uint64_t traceID = 0;
+    uint64_t spanID = 0;
+    uint64_t parentSpanID = 0;
+    std::string service;
+    std::string method;
+    int64_t startTime = 0;
+    int64_t endTime = 0;
+    bool error = false;
+};
+
+class SpanExporter
+{
+public:
+    using Ptr = std::shared_ptr<SpanExporter>;
+    virtual ~SpanExporter() {}
+    virtual void exportSpan(TraceSpan&& _span) = 0;
+};
+
+// keeps the latest finished spans in memory, for tests and benchmarks
+class InMemorySpanExporter : public SpanExporter
+{
+public:
+    using Ptr = std::shared_ptr<InMemorySpanExporter>;
+    explicit InMemorySpanExporter(size_t _capacity = 100000) : m_capacity(_capacity) {}
+
+    void exportSpan(TraceSpan&& _span) override;
+
+    std::vector<TraceSpan> spans() const;
+    // the spans of the given trace, ordered by the start time
+    std::vector<TraceSpan> trace(uint64_t _traceID) const;
+    size_t size() const;
+    void clear();
+
+private:
+    size_t m_capacity;
+    mutable std::mutex x_spans;
+    std::deque<TraceSpan> m_spans;
+};
+
+// the trace context of the current thread, set while a traced callback or a TraceScope is running
+class TraceScope
+{
+public:
+    explicit TraceScope(TraceContext const& _context) : m_previous(current())
+    {
+        current() = _context;
+    }
+    explicit TraceScope(std::map<std::string, std::string> const& _tarsContext)
+      : TraceScope(TraceContext::fromTarsContext(_tarsContext))
+    {}
+    ~TraceScope() { current() = m_previous; }
+
+    TraceScope(TraceScope const&) = delete;
+    TraceScope& operator=(TraceScope const&) = delete;
+
+    static TraceContext& current()
+    {
+        thread_local TraceContext s_current;
+        return s_current;
+    }
+
+private:
+    TraceContext m_previous;
+};
+
+class ClientSpan
+{
+public:
+    struct State
+    {
+        TraceSpan span;
+        std::map<std::string, std::string> tarsContext;
+    };
+
+    ClientSpan() = default;
+    explicit ClientSpan(std::shared_ptr<State> _state) : m_state(std::move(_state)) {}
+
+    bool sampled() const { return m_state != nullptr; }
+    // the request context passed to the tars async call
+    std::map<std::string, std::string> const& context() const
+    {
+        static const std::map<std::string, std::string> c_emptyContext;
+        return m_state ? m_state->tarsContext : c_emptyContext;
+    }
+
+    // finish the span when the response callback is called, and run the callback with the span
+    // as the current trace context so the calls it makes join the same trace; a null callback
+    // means a one-way request whose span ends once sent
+    template <typename Func>
+    Func wrap(Func _callback) const
+    {
+        if (!m_state)
+        {
+            return _callback;
+        }
+        if (!_callback)
+        {
+            finish(*m_state, false);
+            return _callback;
+        }
+        return [state = m_state, callback = std::move(_callback)](auto&&... _args) {
+            finish(*state, detail::hasError(_args...));
+            TraceScope scope(TraceContext{state->span.traceID, state->span.spanID});
+            callback(std::forward<decltype(_args)>(_args)...);
+        };
+    }
+
+private:
+    static void finish(State& _state, bool _error);
+
+    std::shared_ptr<State> m_state;
+};
+
+class ClientTracer
+{
+public:
+    static ClientTracer& instance()
+    {
+        static ClientTracer s_instance;
+        return s_instance;
+    }
+
+    // sample one of every _interval root requests, 0 disables the sampling; the requests made
+    // within a sampled trace are always traced
+    void setSampleInterval(uint32_t _interval)
+    {
+        m_sampleInterval.store(_interval, std::memory_order_relaxed);
+    }
+    uint32_t sampleInterval() const { return m_sampleInterval.load(std::memory_order_relaxed); }
+
+    void setExporter(SpanExporter::Ptr _exporter)
+    {
+        std::lock_guard<std::mutex> lock(x_exporter);
+        m_exporter = std::move(_exporter);
+    }
+
+    // Note: the unsampled path costs two branches and no allocation
+    ClientSpan startSpan(const char* _service, const char* _method)
+    {
+        auto const& current = TraceScope::current();
+        if (!current.sampled())
+        {
+            auto interval = m_sampleInterval.load(std::memory_order_relaxed);
+            if (interval == 0 || (++sampleCounter() % interval) != 0)
+            {
+                return ClientSpan();
+            }
+        }
+        return startSampledSpan(current, _service, _method);
+    }
+
+    void exportSpan(TraceSpan&& _span);
+
+private:
+    ClientTracer() = default;
+
+    ClientSpan startSampledSpan(
+        TraceContext const& _parent, const char* _service, const char* _method);
+    static uint64_t& sampleCounter()
+    {
+        thread_local uint64_t s_counter = 0;
+        return s_counter;
+    }
+
+    std::atomic<uint32_t> m_sampleInterval = {0};
+    std::mutex x_exporter;
+    SpanExporter::Ptr m_exporter;
+};
+}  // namespace bcostars
@@ -0,0 +1,248 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief cached connection state of a tars proxy
+ * @file ConnectionStatus.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <bcos-framework/libutilities/Error.h>
+#include <tarscpp/servant/ServantProxy.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bcostars
+{
+// caches whether the proxy has active endpoints, so checking the connection before sending a
+// message is an atomic load and a timestamp compare instead of copying all the endpoints of the
+// proxy; a connected state older than the max staleness is probed again by check, so a lost
+// connection is detected even if no ConnectionMonitor is started, and the running monitor keeps
+// the state fresh so check never probes on the sending path
+class ConnectionStatus
+{
+public:
+    using Ptr = std::shared_ptr<ConnectionStatus>;
+    using Probe = std::function<bool()>;
+
+    static constexpr std::chrono::milliseconds c_defaultMaxStaleness{3000};
+
+    explicit ConnectionStatus(
+        Probe _probe, std::chrono::milliseconds _maxStaleness = c_defaultMaxStaleness)
+      : m_probe(std::move(_probe)),
+        m_maxStaleness(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(_maxStaleness).count())
+    {}
+
+    // create the status of the given proxy and register it to the ConnectionMonitor
+    template <typename T>
+    static Ptr create(T _prx);
+
+    bool connected() const { return m_connected.load(std::memory_order_relaxed); }
+
+    // probe the endpoints of the proxy and update the cached state
+    bool refresh()
+    {
+        auto connected = m_probe();
+        m_connected.store(connected, std::memory_order_relaxed);
+        m_probedAt.store(now(), std::memory_order_relaxed);
+        return connected;
+    }
+
+    // the cached state is trusted when connected and not stale, a stale one is probed again by
+    // one of the callers while the others still trust it, and a disconnected state is always
+    // probed again so the recovered connection can be used at once
+    bool check(std::string const& _module, std::string const& _func,
+        std::function<void(bcos::Error::Ptr)> const& _errorCallback)
+    {
+        if (m_connected.load(std::memory_order_relaxed))
+        {
+            auto probedAt = m_probedAt.load(std::memory_order_relaxed);
+            auto current = now();
+            if (current - probedAt < m_maxStaleness ||
+                !m_probedAt.compare_exchange_strong(
+                    probedAt, current, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        if (refresh())
+        {
+            return true;
+        }
+        if (_errorCallback)
+        {
+            std::string errorMessage =
+                _module + " calls interface " + _func + " failed for empty connection";
+            _errorCallback(std::make_shared<bcos::Error>(-1, errorMessage));
+        }
+        return false;
+    }
+
+private:
+    static std::chrono::steady_clock::rep now()
+    {
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+
+    Probe m_probe;
+    std::chrono::steady_clock::rep m_maxStaleness;
+    std::atomic_bool m_connected = {false};
+    std::atomic<std::chrono::steady_clock::rep> m_probedAt = {0};
+};
+
+// refreshes all the registered ConnectionStatus periodically in one background thread, which is
+// owned by the application: start it once the tars communicator is ready, and stop it before the
+// communicator is destroyed; it is optional, without it the states are probed again by check
+// once stale, i.e. on the sending path of the clients
+class ConnectionMonitor
+{
+public:
+    static ConnectionMonitor& instance()
+    {
+        static ConnectionMonitor s_instance;
+        return s_instance;
+    }
+    // the application should have stopped the monitor already
+    ~ConnectionMonitor() { stop(); }
+
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(x_statuses);
+        if (m_worker.joinable())
+        {
+            return;
+        }
+        m_stopped = false;
+        m_worker = std::thread([this]() { run(); });
+    }
+
+    void stop()
+    {
+        std::thread worker;
+        {
+            std::lock_guard<std::mutex> lock(x_statuses);
+            m_stopped = true;
+            worker = std::move(m_worker);
+        }
+        m_signal.notify_all();
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+
+    bool running()
+    {
+        std::lock_guard<std::mutex> lock(x_statuses);
+        return m_worker.joinable();
+    }
+
+    void registerStatus(ConnectionStatus::Ptr const& _status)
+    {
+        std::lock_guard<std::mutex> lock(x_statuses);
+        m_statuses.emplace_back(_status);
+    }
+
+    void setRefreshInterval(std::chrono::milliseconds _interval)
+    {
+        {
+            std::lock_guard<std::mutex> lock(x_statuses);
+            m_refreshInterval = _interval;
+            m_refreshPending = true;
+        }
+        m_signal.notify_all();
+    }
+
+    // refresh all the statuses immediately, e.g. when the endpoints of the proxies changed; the
+    // request is kept until the next round starts, so it is not lost while the worker is probing
+    void refreshAll()
+    {
+        {
+            std::lock_guard<std::mutex> lock(x_statuses);
+            m_refreshPending = true;
+        }
+        m_signal.notify_all();
+    }
+
+private:
+    ConnectionMonitor() = default;
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(x_statuses);
+        while (!m_stopped)
+        {
+            m_refreshPending = false;
+            // release the lock while probing, so the registration won't be blocked
+            auto statuses = m_statuses;
+            lock.unlock();
+            bool expired = false;
+            for (auto const& it : statuses)
+            {
+                auto status = it.lock();
+                if (!status)
+                {
+                    expired = true;
+                    continue;
+                }
+                status->refresh();
+            }
+            lock.lock();
+            if (expired)
+            {
+                m_statuses.erase(std::remove_if(m_statuses.begin(), m_statuses.end(),
+                                     [](auto const& _status) { return _status.expired(); }),
+                    m_statuses.end());
+            }
+            m_signal.wait_for(
+                lock, m_refreshInterval, [this]() { return m_stopped || m_refreshPending; });
+        }
+    }
+
+    std::mutex x_statuses;
+    std::condition_variable m_signal;
+    std::vector<std::weak_ptr<ConnectionStatus>> m_statuses;
+    std::chrono::milliseconds m_refreshInterval = std::chrono::milliseconds(1000);
+    bool m_stopped = false;
+    bool m_refreshPending = false;
+    std::thread m_worker;
+};
+
+template <typename T>
+ConnectionStatus::Ptr ConnectionStatus::create(T _prx)
+{
+    auto status = std::make_shared<ConnectionStatus>([_prx]() {
+        if (!_prx.get())
+        {
+            return false;
+        }
+        std::vector<tars::EndpointInfo> activeEndPoints;
+        std::vector<tars::EndpointInfo> nactiveEndPoints;
+        _prx->tars_endpointsAll(activeEndPoints, nactiveEndPoints);
+        return activeEndPoints.size() > 0;
+    });
+    ConnectionMonitor::instance().registerStatus(status);
+    return status;
+}
+}  // namespace bcostars
@@ -2,6 +2,10 @@
 
 #include "bcos-tars-protocol/Common.h"
 #include "bcos-tars-protocol/ErrorConverter.h"
+#include "bcos-tars-protocol/client/ClientMetrics.h"
+#include "bcos-tars-protocol/client/ConnectionStatus.h"
+#include "bcos-tars-protocol/client/ProxyLanes.h"
+#include "bcos-tars-protocol/client/SharedPayload.h"
 #include "bcos-tars-protocol/tars/FrontService.h"
 #include <bcos-framework/interfaces/crypto/KeyFactory.h>
 #include <bcos-framework/interfaces/front/FrontServiceInterface.h>
@@ -17,11 +21,21 @@ public:
     void stop() override {}
 
     FrontServiceClient(bcostars::FrontServicePrx proxy, bcos::crypto::KeyFactory::Ptr keyFactory)
-      : m_proxy(proxy), m_keyFactory(keyFactory)
+      : m_proxy(proxy),
+        m_connection(ConnectionStatus::create(proxy)),
+        m_lanes(proxy, m_connection),
+        m_keyFactory(keyFactory)
     {}
 
+    // the messages of the modules routed to another lane, e.g. consensus, are sent through the
+    // proxy of that lane instead of queueing behind the block sync messages
+    ProxyLanes<bcostars::FrontServicePrx>& lanes() { return m_lanes; }
+
     void asyncGetNodeIDs(bcos::front::GetNodeIDsFunc _getNodeIDsFunc) override
     {
+        _getNodeIDsFunc = instrumentCallback(
+            BCOS_CLIENT_METRICS("FrontService", "asyncGetNodeIDs"), std::move(_getNodeIDsFunc));
+
         class Callback : public FrontServicePrxCallback
         {
         public:
@@ -58,6 +72,10 @@ public:
         std::shared_ptr<const bcos::crypto::NodeIDs> _nodeIDs,
         bcos::front::ReceiveMsgFunc _receiveMsgCallback) override
     {
+        _receiveMsgCallback = instrumentCallback(
+            BCOS_CLIENT_METRICS("FrontService", "onReceiveNodeIDs"),
+            std::move(_receiveMsgCallback));
+
         class Callback : public FrontServicePrxCallback
         {
         public:
@@ -99,6 +117,10 @@ public:
     void onReceiveMessage(const std::string& _groupID, bcos::crypto::NodeIDPtr _nodeID,
         bcos::bytesConstRef _data, bcos::front::ReceiveMsgFunc _receiveMsgCallback) override
     {
+        _receiveMsgCallback = instrumentCallback(
+            BCOS_CLIENT_METRICS("FrontService", "onReceiveMessage"),
+            std::move(_receiveMsgCallback), _data.size());
+
         class Callback : public FrontServicePrxCallback
         {
         public:
@@ -125,7 +147,7 @@ public:
         private:
             bcos::front::ReceiveMsgFunc m_callback;
         };
-        auto ret = checkConnection(c_moduleName, "onReceiveMessage", m_proxy,
+        auto ret = m_connection->check(c_moduleName, "onReceiveMessage",
             [_receiveMsgCallback](bcos::Error::Ptr _error) {
                 if (_receiveMsgCallback)
                 {
@@ -146,6 +168,10 @@ public:
     void onReceiveBroadcastMessage(const std::string& _groupID, bcos::crypto::NodeIDPtr _nodeID,
         bcos::bytesConstRef _data, bcos::front::ReceiveMsgFunc _receiveMsgCallback) override
     {
+        _receiveMsgCallback = instrumentCallback(
+            BCOS_CLIENT_METRICS("FrontService", "onReceiveBroadcastMessage"),
+            std::move(_receiveMsgCallback), _data.size());
+
         class Callback : public FrontServicePrxCallback
         {
         public:
@@ -172,7 +198,7 @@ public:
         private:
             bcos::front::ReceiveMsgFunc m_callback;
         };
-        auto ret = checkConnection(c_moduleName, "onReceiveBroadcastMessage", m_proxy,
+        auto ret = m_connection->check(c_moduleName, "onReceiveBroadcastMessage",
             [_receiveMsgCallback](bcos::Error::Ptr _error) {
                 if (_receiveMsgCallback)
                 {
@@ -193,6 +219,10 @@ public:
     void asyncSendMessageByNodeID(int _moduleID, bcos::crypto::NodeIDPtr _nodeID,
         bcos::bytesConstRef _data, uint32_t _timeout, bcos::front::CallbackFunc _callback) override
     {
+        _callback = instrumentCallback(
+            BCOS_CLIENT_METRICS("FrontService", "asyncSendMessageByNodeID"),
+            std::move(_callback), _data.size());
+
         class Callback : public FrontServicePrxCallback
         {
         public:
@@ -231,7 +261,8 @@ public:
         };
 
         auto nodeIDData = _nodeID->data();
-        m_proxy->async_asyncSendMessageByNodeID(new Callback(_callback, this), _moduleID,
+        m_lanes.proxyOfModule(_moduleID)->async_asyncSendMessageByNodeID(
+            new Callback(_callback, this), _moduleID,
             std::vector<char>(nodeIDData.begin(), nodeIDData.end()),
             std::vector<char>(_data.begin(), _data.end()), _timeout, (_callback ? true : false));
     }
@@ -239,7 +270,10 @@ public:
     void asyncSendResponse(const std::string& _id, int _moduleID, bcos::crypto::NodeIDPtr _nodeID,
         bcos::bytesConstRef _data, bcos::front::ReceiveMsgFunc _receiveMsgCallback) override
     {
-        auto ret = checkConnection(c_moduleName, "asyncSendResponse", m_proxy,
+        BCOS_CLIENT_METRICS("FrontService", "asyncSendResponse").onOneWayRequest(_data.size());
+
+        auto const& lane = m_lanes.laneOfModule(_moduleID);
+        auto ret = lane.status->check(c_moduleName, "asyncSendResponse",
             [_receiveMsgCallback](bcos::Error::Ptr _error) {
                 if (_receiveMsgCallback)
                 {
@@ -251,7 +285,7 @@ public:
             return;
         }
         auto nodeIDData = _nodeID->data();
-        m_proxy->asyncSendResponse(_id, _moduleID,
+        lane.proxy->asyncSendResponse(_id, _moduleID,
             std::vector<char>(nodeIDData.begin(), nodeIDData.end()),
             std::vector<char>(_data.begin(), _data.end()));
     }
@@ -259,6 +293,16 @@ public:
     void asyncSendMessageByNodeIDs(int _moduleID,
         const std::vector<bcos::crypto::NodeIDPtr>& _nodeIDs, bcos::bytesConstRef _data) override
     {
+        asyncSendMessageByNodeIDs(_moduleID, _nodeIDs, SharedPayload(_data));
+    }
+
+    // the payload shared with the other sends is passed to tars without copying
+    void asyncSendMessageByNodeIDs(int _moduleID,
+        const std::vector<bcos::crypto::NodeIDPtr>& _nodeIDs, SharedPayload const& _data)
+    {
+        BCOS_CLIENT_METRICS("FrontService", "asyncSendMessageByNodeIDs")
+            .onOneWayRequest(_data.size());
+
         std::vector<std::vector<char>> tarsNodeIDs;
         tarsNodeIDs.reserve(_nodeIDs.size());
         for (auto const& it : _nodeIDs)
@@ -266,19 +310,28 @@ public:
             auto nodeIDData = it->data();
             tarsNodeIDs.emplace_back(nodeIDData.begin(), nodeIDData.end());
         }
-        m_proxy->async_asyncSendMessageByNodeIDs(
-            nullptr, _moduleID, tarsNodeIDs, std::vector<char>(_data.begin(), _data.end()));
+        m_lanes.proxyOfModule(_moduleID)->async_asyncSendMessageByNodeIDs(
+            nullptr, _moduleID, tarsNodeIDs, _data.tarsData());
     }
 
     void asyncSendBroadcastMessage(int _moduleID, bcos::bytesConstRef _data) override
     {
-        auto data = _data.toBytes();
-        m_proxy->async_asyncSendBroadcastMessage(
-            nullptr, _moduleID, std::vector<char>(data.begin(), data.end()));
+        asyncSendBroadcastMessage(_moduleID, SharedPayload(_data));
+    }
+
+    void asyncSendBroadcastMessage(int _moduleID, SharedPayload const& _data)
+    {
+        BCOS_CLIENT_METRICS("FrontService", "asyncSendBroadcastMessage")
+            .onOneWayRequest(_data.size());
+
+        m_lanes.proxyOfModule(_moduleID)->async_asyncSendBroadcastMessage(
+            nullptr, _moduleID, _data.tarsData());
     }
 
 private:
     bcostars::FrontServicePrx m_proxy;
+    ConnectionStatus::Ptr m_connection;
+    ProxyLanes<bcostars::FrontServicePrx> m_lanes;
     bcos::crypto::KeyFactory::Ptr m_keyFactory;
     std::string const c_moduleName = "FrontServiceClient";
 };
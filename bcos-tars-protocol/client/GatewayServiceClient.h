@@ -22,6 +22,10 @@
 
 #include "bcos-tars-protocol/Common.h"
 #include "bcos-tars-protocol/ErrorConverter.h"
+#include "bcos-tars-protocol/client/ClientMetrics.h"
+#include "bcos-tars-protocol/client/ConnectionStatus.h"
+#include "bcos-tars-protocol/client/ProxyLanes.h"
+#include "bcos-tars-protocol/client/SharedPayload.h"
 #include "bcos-tars-protocol/tars/GatewayService.h"
 #include <bcos-framework/interfaces/crypto/KeyFactory.h>
 #include <bcos-framework/interfaces/gateway/GatewayInterface.h>
@@ -36,17 +40,41 @@ class GatewayServiceClient : public bcos::gateway::GatewayInterface
 public:
     GatewayServiceClient(
         bcostars::GatewayServicePrx _proxy, bcos::crypto::KeyFactory::Ptr keyFactory)
-      : m_proxy(_proxy), m_keyFactory(keyFactory)
+      : m_proxy(_proxy),
+        m_connection(ConnectionStatus::create(_proxy)),
+        m_lanes(_proxy, m_connection),
+        m_keyFactory(keyFactory)
+    {}
+    GatewayServiceClient(bcostars::GatewayServicePrx _proxy)
+      : m_proxy(_proxy),
+        m_connection(ConnectionStatus::create(_proxy)),
+        m_lanes(_proxy, m_connection)
     {}
-    GatewayServiceClient(bcostars::GatewayServicePrx _proxy) : m_proxy(_proxy) {}
     virtual ~GatewayServiceClient() {}
 
+    // the payloads don't carry the moduleID readable here, so the sends are routed to the lanes by
+    // the method name, e.g. the broadcasts of the block sync to the bulk lane
+    ProxyLanes<bcostars::GatewayServicePrx>& lanes() { return m_lanes; }
+
     void setKeyFactory(bcos::crypto::KeyFactory::Ptr keyFactory) { m_keyFactory = keyFactory; }
 
     void asyncSendMessageByNodeID(const std::string& _groupID, bcos::crypto::NodeIDPtr _srcNodeID,
         bcos::crypto::NodeIDPtr _dstNodeID, bcos::bytesConstRef _payload,
         bcos::gateway::ErrorRespFunc _errorRespFunc) override
     {
+        asyncSendMessageByNodeID(_groupID, std::move(_srcNodeID), std::move(_dstNodeID),
+            SharedPayload(_payload), std::move(_errorRespFunc));
+    }
+
+    // the payload shared with the other sends is passed to tars without copying
+    void asyncSendMessageByNodeID(const std::string& _groupID, bcos::crypto::NodeIDPtr _srcNodeID,
+        bcos::crypto::NodeIDPtr _dstNodeID, SharedPayload const& _payload,
+        bcos::gateway::ErrorRespFunc _errorRespFunc)
+    {
+        _errorRespFunc = instrumentCallback(
+            BCOS_CLIENT_METRICS("GatewayService", "asyncSendMessageByNodeID"),
+            std::move(_errorRespFunc), _payload.size());
+
         class Callback : public bcostars::GatewayServicePrxCallback
         {
         public:
@@ -64,7 +92,8 @@ public:
         private:
             bcos::gateway::ErrorRespFunc m_callback;
         };
-        auto ret = checkConnection(c_moduleName, "asyncSendMessageByNodeID", m_proxy,
+        auto const& lane = m_lanes.laneOfMethod("asyncSendMessageByNodeID");
+        auto ret = lane.status->check(c_moduleName, "asyncSendMessageByNodeID",
             [_errorRespFunc](bcos::Error::Ptr _error) {
                 if (_errorRespFunc)
                 {
@@ -77,17 +106,19 @@ public:
         }
         auto srcNodeID = _srcNodeID->data();
         auto destNodeID = _dstNodeID->data();
-        m_proxy->tars_set_timeout(c_networkTimeout)
+        lane.proxy->tars_set_timeout(c_networkTimeout)
             ->async_asyncSendMessageByNodeID(new Callback(_errorRespFunc), _groupID,
                 std::vector<char>(srcNodeID.begin(), srcNodeID.end()),
-                std::vector<char>(destNodeID.begin(), destNodeID.end()),
-                std::vector<char>(_payload.begin(), _payload.end()));
+                std::vector<char>(destNodeID.begin(), destNodeID.end()), _payload.tarsData());
     }
 
     void asyncGetPeers(std::function<void(
             bcos::Error::Ptr, bcos::gateway::GatewayInfo::Ptr, bcos::gateway::GatewayInfosPtr)>
             _callback) override
     {
+        _callback = instrumentCallback(
+            BCOS_CLIENT_METRICS("GatewayService", "asyncGetPeers"), std::move(_callback));
+
         class Callback : public bcostars::GatewayServicePrxCallback
         {
         public:
@@ -119,8 +150,8 @@ public:
                 bcos::Error::Ptr, bcos::gateway::GatewayInfo::Ptr, bcos::gateway::GatewayInfosPtr)>
                 m_callback;
         };
-        auto ret = checkConnection(
-            c_moduleName, "asyncGetPeers", m_proxy, [_callback](bcos::Error::Ptr _error) {
+        auto ret = m_connection->check(
+            c_moduleName, "asyncGetPeers", [_callback](bcos::Error::Ptr _error) {
                 if (_callback)
                 {
                     _callback(_error, nullptr, nullptr);
@@ -136,40 +167,63 @@ public:
     void asyncSendMessageByNodeIDs(const std::string& _groupID, bcos::crypto::NodeIDPtr _srcNodeID,
         const bcos::crypto::NodeIDs& _dstNodeIDs, bcos::bytesConstRef _payload) override
     {
+        asyncSendMessageByNodeIDs(
+            _groupID, std::move(_srcNodeID), _dstNodeIDs, SharedPayload(_payload));
+    }
+
+    void asyncSendMessageByNodeIDs(const std::string& _groupID, bcos::crypto::NodeIDPtr _srcNodeID,
+        const bcos::crypto::NodeIDs& _dstNodeIDs, SharedPayload const& _payload)
+    {
+        BCOS_CLIENT_METRICS("GatewayService", "asyncSendMessageByNodeIDs")
+            .onOneWayRequest(_payload.size());
+
         std::vector<std::vector<char>> tarsNodeIDs;
         for (auto const& it : _dstNodeIDs)
         {
             auto nodeID = it->data();
             tarsNodeIDs.emplace_back(nodeID.begin(), nodeID.end());
         }
-        auto ret = checkConnection(c_moduleName, "asyncSendMessageByNodeIDs", m_proxy, nullptr);
+        auto const& lane = m_lanes.laneOfMethod("asyncSendMessageByNodeIDs");
+        auto ret = lane.status->check(c_moduleName, "asyncSendMessageByNodeIDs", nullptr);
         if (!ret)
         {
             return;
         }
         auto srcNodeID = _srcNodeID->data();
-        m_proxy->async_asyncSendMessageByNodeIDs(nullptr, _groupID,
+        lane.proxy->async_asyncSendMessageByNodeIDs(nullptr, _groupID,
             std::vector<char>(srcNodeID.begin(), srcNodeID.end()), tarsNodeIDs,
-            std::vector<char>(_payload.begin(), _payload.end()));
+            _payload.tarsData());
     }
 
     void asyncSendBroadcastMessage(const std::string& _groupID, bcos::crypto::NodeIDPtr _srcNodeID,
         bcos::bytesConstRef _payload) override
     {
-        auto ret = checkConnection(c_moduleName, "asyncSendBroadcastMessage", m_proxy, nullptr);
+        asyncSendBroadcastMessage(_groupID, std::move(_srcNodeID), SharedPayload(_payload));
+    }
+
+    void asyncSendBroadcastMessage(const std::string& _groupID, bcos::crypto::NodeIDPtr _srcNodeID,
+        SharedPayload const& _payload)
+    {
+        BCOS_CLIENT_METRICS("GatewayService", "asyncSendBroadcastMessage")
+            .onOneWayRequest(_payload.size());
+
+        auto const& lane = m_lanes.laneOfMethod("asyncSendBroadcastMessage");
+        auto ret = lane.status->check(c_moduleName, "asyncSendBroadcastMessage", nullptr);
         if (!ret)
         {
             return;
         }
         auto srcNodeID = _srcNodeID->data();
-        m_proxy->async_asyncSendBroadcastMessage(nullptr, _groupID,
-            std::vector<char>(srcNodeID.begin(), srcNodeID.end()),
-            std::vector<char>(_payload.begin(), _payload.end()));
+        lane.proxy->async_asyncSendBroadcastMessage(nullptr, _groupID,
+            std::vector<char>(srcNodeID.begin(), srcNodeID.end()), _payload.tarsData());
     }
 
     void asyncGetNodeIDs(
         const std::string& _groupID, bcos::gateway::GetNodeIDsFunc _getNodeIDsFunc) override
     {
+        _getNodeIDsFunc = instrumentCallback(
+            BCOS_CLIENT_METRICS("GatewayService", "asyncGetNodeIDs"), std::move(_getNodeIDsFunc));
+
         class Callback : public GatewayServicePrxCallback
         {
         public:
@@ -198,8 +252,8 @@ public:
             bcos::gateway::GetNodeIDsFunc m_callback;
             bcos::crypto::KeyFactory::Ptr m_keyFactory;
         };
-        auto ret = checkConnection(
-            c_moduleName, "asyncGetNodeIDs", m_proxy, [_getNodeIDsFunc](bcos::Error::Ptr _error) {
+        auto ret = m_connection->check(
+            c_moduleName, "asyncGetNodeIDs", [_getNodeIDsFunc](bcos::Error::Ptr _error) {
                 if (_getNodeIDsFunc)
                 {
                     _getNodeIDsFunc(_error, nullptr);
@@ -215,6 +269,9 @@ public:
     void asyncNotifyGroupInfo(bcos::group::GroupInfo::Ptr _groupInfo,
         std::function<void(bcos::Error::Ptr&&)> _callback) override
     {
+        _callback = instrumentCallback(
+            BCOS_CLIENT_METRICS("GatewayService", "asyncNotifyGroupInfo"), std::move(_callback));
+
         class Callback : public bcostars::GatewayServicePrxCallback
         {
         public:
@@ -232,8 +289,8 @@ public:
         private:
             std::function<void(bcos::Error::Ptr&&)> m_callback;
         };
-        auto ret = checkConnection(
-            c_moduleName, "asyncNotifyGroupInfo", m_proxy, [_callback](bcos::Error::Ptr _error) {
+        auto ret = m_connection->check(
+            c_moduleName, "asyncNotifyGroupInfo", [_callback](bcos::Error::Ptr _error) {
                 if (_callback)
                 {
                     _callback(std::move(_error));
@@ -250,6 +307,10 @@ public:
     void asyncSendMessageByTopic(const std::string& _topic, bcos::bytesConstRef _data,
         std::function<void(bcos::Error::Ptr&&, int16_t, bcos::bytesPointer)> _respFunc) override
     {
+        _respFunc = instrumentCallback(
+            BCOS_CLIENT_METRICS("GatewayService", "asyncSendMessageByTopic"),
+            std::move(_respFunc), _data.size());
+
         class Callback : public bcostars::GatewayServicePrxCallback
         {
         public:
@@ -271,8 +332,9 @@ public:
         private:
             std::function<void(bcos::Error::Ptr&&, int16_t, bcos::bytesPointer)> m_callback;
         };
-        auto ret = checkConnection(
-            c_moduleName, "asyncSendMessageByTopic", m_proxy, [_respFunc](bcos::Error::Ptr _error) {
+        auto const& lane = m_lanes.laneOfMethod("asyncSendMessageByTopic");
+        auto ret = lane.status->check(
+            c_moduleName, "asyncSendMessageByTopic", [_respFunc](bcos::Error::Ptr _error) {
                 if (_respFunc)
                 {
                     _respFunc(std::move(_error), 0, nullptr);
@@ -283,26 +345,32 @@ public:
             return;
         }
         vector<tars::Char> tarsRequestData(_data.begin(), _data.end());
-        m_proxy->tars_set_timeout(c_amopTimeout)
+        lane.proxy->tars_set_timeout(c_amopTimeout)
             ->async_asyncSendMessageByTopic(new Callback(_respFunc), _topic, tarsRequestData);
     }
 
     void asyncSendBroadbastMessageByTopic(
         const std::string& _topic, bcos::bytesConstRef _data) override
     {
-        auto ret =
-            checkConnection(c_moduleName, "asyncSendBroadbastMessageByTopic", m_proxy, nullptr);
+        BCOS_CLIENT_METRICS("GatewayService", "asyncSendBroadbastMessageByTopic")
+            .onOneWayRequest(_data.size());
+
+        auto const& lane = m_lanes.laneOfMethod("asyncSendBroadbastMessageByTopic");
+        auto ret = lane.status->check(c_moduleName, "asyncSendBroadbastMessageByTopic", nullptr);
         if (!ret)
         {
             return;
         }
         vector<tars::Char> tarsRequestData(_data.begin(), _data.end());
-        m_proxy->async_asyncSendBroadbastMessageByTopic(nullptr, _topic, tarsRequestData);
+        lane.proxy->async_asyncSendBroadbastMessageByTopic(nullptr, _topic, tarsRequestData);
     }
 
     void asyncSubscribeTopic(std::string const& _clientID, std::string const& _topicInfo,
         std::function<void(bcos::Error::Ptr&&)> _callback) override
     {
+        _callback = instrumentCallback(
+            BCOS_CLIENT_METRICS("GatewayService", "asyncSubscribeTopic"), std::move(_callback));
+
         class Callback : public bcostars::GatewayServicePrxCallback
         {
         public:
@@ -319,8 +387,8 @@ public:
         private:
             std::function<void(bcos::Error::Ptr&&)> m_callback;
         };
-        auto ret = checkConnection(
-            c_moduleName, "asyncSubscribeTopic", m_proxy, [_callback](bcos::Error::Ptr _error) {
+        auto ret = m_connection->check(
+            c_moduleName, "asyncSubscribeTopic", [_callback](bcos::Error::Ptr _error) {
                 if (_callback)
                 {
                     _callback(std::move(_error));
@@ -336,6 +404,9 @@ public:
     void asyncRemoveTopic(std::string const& _clientID, std::vector<std::string> const& _topicList,
         std::function<void(bcos::Error::Ptr&&)> _callback) override
     {
+        _callback = instrumentCallback(
+            BCOS_CLIENT_METRICS("GatewayService", "asyncRemoveTopic"), std::move(_callback));
+
         class Callback : public bcostars::GatewayServicePrxCallback
         {
         public:
@@ -352,8 +423,8 @@ public:
         private:
             std::function<void(bcos::Error::Ptr&&)> m_callback;
         };
-        auto ret = checkConnection(
-            c_moduleName, "asyncRemoveTopic", m_proxy, [_callback](bcos::Error::Ptr _error) {
+        auto ret = m_connection->check(
+            c_moduleName, "asyncRemoveTopic", [_callback](bcos::Error::Ptr _error) {
                 if (_callback)
                 {
                     _callback(std::move(_error));
@@ -374,6 +445,8 @@ protected:
 
 private:
     bcostars::GatewayServicePrx m_proxy;
+    ConnectionStatus::Ptr m_connection;
+    ProxyLanes<bcostars::GatewayServicePrx> m_lanes;
     bcos::crypto::KeyFactory::Ptr m_keyFactory;
     std::string const c_moduleName = "GatewayServiceClient";
     // AMOP timeout 40s
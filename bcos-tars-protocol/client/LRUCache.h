@@ -0,0 +1,169 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief thread-safe LRU cache bounded by the memory of its entries
+ * @file LRUCache.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace bcostars
+{
+struct CacheStats
+{
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t bytes = 0;
+    size_t capacity = 0;
+};
+
+// hashes are uniformly distributed, so their leading bytes are a good enough hash key
+template <typename HashType>
+struct LeadingBytesHasher
+{
+    size_t operator()(HashType const& _hash) const
+    {
+        size_t value = 0;
+        std::memcpy(&value, _hash.data(), std::min(sizeof(value), (size_t)_hash.size));
+        return value;
+    }
+};
+
+// every entry is charged with its declared size plus c_entryOverhead bytes, the least recently
+// used entries are evicted once the total exceeds the capacity; a zero capacity disables the cache
+template <typename Key, typename Value, typename Hasher = std::hash<Key>>
+class LRUCache
+{
+public:
+    // the bookkeeping memory of an entry: the list node and the hash table node
+    static constexpr size_t c_entryOverhead = 64;
+
+    explicit LRUCache(size_t _capacity = 0) : m_capacity(_capacity) {}
+
+    bool enabled() const { return m_capacity.load(std::memory_order_relaxed) > 0; }
+
+    void setCapacity(size_t _capacity)
+    {
+        std::lock_guard<std::mutex> lock(x_cache);
+        m_capacity.store(_capacity, std::memory_order_relaxed);
+        evict();
+    }
+
+    std::optional<Value> get(Key const& _key)
+    {
+        std::lock_guard<std::mutex> lock(x_cache);
+        auto it = m_index.find(_key);
+        if (it == m_index.end())
+        {
+            m_misses++;
+            return std::nullopt;
+        }
+        m_hits++;
+        // move to the most recently used position
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->value;
+    }
+
+    void put(Key const& _key, Value _value, size_t _size)
+    {
+        auto charge = _size + c_entryOverhead;
+        std::lock_guard<std::mutex> lock(x_cache);
+        if (charge > m_capacity.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        auto it = m_index.find(_key);
+        if (it != m_index.end())
+        {
+            m_bytes -= it->second->size;
+            it->second->value = std::move(_value);
+            it->second->size = charge;
+            m_bytes += charge;
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+        }
+        else
+        {
+            m_entries.push_front(Entry{_key, std::move(_value), charge});
+            m_index.emplace(_key, m_entries.begin());
+            m_bytes += charge;
+        }
+        evict();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(x_cache);
+        m_entries.clear();
+        m_index.clear();
+        m_bytes = 0;
+    }
+
+    CacheStats stats() const
+    {
+        std::lock_guard<std::mutex> lock(x_cache);
+        CacheStats stats;
+        stats.hits = m_hits;
+        stats.misses = m_misses;
+        stats.evictions = m_evictions;
+        stats.entries = m_index.size();
+        stats.bytes = m_bytes;
+        stats.capacity = m_capacity.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+private:
+    struct Entry
+    {
+        Key key;
+        Value value;
+        size_t size;
+    };
+
+    // Note: must be called with x_cache locked
+    void evict()
+    {
+        auto capacity = m_capacity.load(std::memory_order_relaxed);
+        while (m_bytes > capacity && !m_entries.empty())
+        {
+            auto const& last = m_entries.back();
+            m_bytes -= last.size;
+            m_index.erase(last.key);
+            m_entries.pop_back();
+            m_evictions++;
+        }
+    }
+
+    std::atomic<size_t> m_capacity;
+    mutable std::mutex x_cache;
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, typename std::list<Entry>::iterator, Hasher> m_index;
+    size_t m_bytes = 0;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+    uint64_t m_evictions = 0;
+};
+}  // namespace bcostars
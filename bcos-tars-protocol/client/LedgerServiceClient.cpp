@@ -20,16 +20,70 @@
 #include "LedgerServiceClient.h"
 #include "bcos-tars-protocol/Common.h"
 #include "bcos-tars-protocol/ErrorConverter.h"
+#include "bcos-tars-protocol/client/BlockRangeFetcher.h"
+#include "bcos-tars-protocol/client/ClientMetrics.h"
 #include "bcos-tars-protocol/protocol/BlockImpl.h"
+#include "bcos-tars-protocol/protocol/PresenceBitmap.h"
 #include "bcos-tars-protocol/protocol/TransactionImpl.h"
 #include "bcos-tars-protocol/protocol/TransactionReceiptImpl.h"
 
 using namespace bcostars;
 
+namespace
+{
+// the approximate memory held by the decoded receipt
+size_t receiptMemorySize(bcos::protocol::TransactionReceipt const& _receipt)
+{
+    auto receiptImpl = dynamic_cast<bcostars::protocol::TransactionReceiptImpl const*>(&_receipt);
+    if (!receiptImpl)
+    {
+        return sizeof(bcostars::TransactionReceipt);
+    }
+    auto const& inner = receiptImpl->inner();
+    size_t size = sizeof(bcostars::TransactionReceipt) + inner.dataHash.size() +
+                  inner.data.gasUsed.size() + inner.data.contractAddress.size() +
+                  inner.data.output.size();
+    for (auto const& logEntry : inner.data.logEntries)
+    {
+        size += sizeof(bcostars::LogEntry) + logEntry.address.size() + logEntry.data.size();
+        for (auto const& topic : logEntry.topic)
+        {
+            size += sizeof(topic) + topic.size();
+        }
+    }
+    return size;
+}
+
+size_t proofMemorySize(bcos::ledger::MerkleProofPtr const& _proof)
+{
+    if (!_proof)
+    {
+        return 0;
+    }
+    size_t size = sizeof(bcos::ledger::MerkleProof);
+    for (auto const& item : *_proof)
+    {
+        size += sizeof(item);
+        for (auto const& hash : item.first)
+        {
+            size += sizeof(hash) + hash.size();
+        }
+        for (auto const& hash : item.second)
+        {
+            size += sizeof(hash) + hash.size();
+        }
+    }
+    return size;
+}
+}  // namespace
+
 void LedgerServiceClient::asyncGetBlockDataByNumber(bcos::protocol::BlockNumber _blockNumber,
     int32_t _blockFlag,
     std::function<void(bcos::Error::Ptr, bcos::protocol::Block::Ptr)> _onGetBlock)
 {
+    _onGetBlock = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetBlockDataByNumber"), std::move(_onGetBlock));
+
     class Callback : public LedgerServicePrxCallback
     {
     public:
@@ -61,6 +115,22 @@ void LedgerServiceClient::asyncGetBlockDataByNumber(bcos::protocol::BlockNumber
 void LedgerServiceClient::asyncGetBlockNumber(
     std::function<void(bcos::Error::Ptr, bcos::protocol::BlockNumber)> _onGetBlock)
 {
+    if (configCacheEnabled())
+    {
+        _onGetBlock = [systemConfigCache = m_systemConfigCache, nodeListCache = m_nodeListCache,
+                          callback = std::move(_onGetBlock)](
+                          bcos::Error::Ptr _error, bcos::protocol::BlockNumber _blockNumber) {
+            if (!_error)
+            {
+                systemConfigCache->notifyBlockNumber(_blockNumber);
+                nodeListCache->notifyBlockNumber(_blockNumber);
+            }
+            callback(std::move(_error), _blockNumber);
+        };
+    }
+    _onGetBlock = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetBlockNumber"), std::move(_onGetBlock));
+
     class Callback : public LedgerServicePrxCallback
     {
     public:
@@ -86,6 +156,29 @@ void LedgerServiceClient::asyncGetBlockNumber(
 void LedgerServiceClient::asyncGetBlockHashByNumber(bcos::protocol::BlockNumber _blockNumber,
     std::function<void(bcos::Error::Ptr, bcos::crypto::HashType)> _onGetBlock)
 {
+    if (m_blockHashCache->enabled())
+    {
+        auto blockHash = m_blockHashCache->get(_blockNumber);
+        if (blockHash)
+        {
+            _onGetBlock(nullptr, *blockHash);
+            return;
+        }
+        _onGetBlock = [blockHashCache = m_blockHashCache, blockNumberCache = m_blockNumberCache,
+                          _blockNumber, callback = std::move(_onGetBlock)](
+                          bcos::Error::Ptr _error, bcos::crypto::HashType _blockHash) {
+            if (!_error && _blockHash != bcos::crypto::HashType())
+            {
+                auto size = sizeof(_blockNumber) + bcos::crypto::HashType::size;
+                blockHashCache->put(_blockNumber, _blockHash, size);
+                blockNumberCache->put(_blockHash, _blockNumber, size);
+            }
+            callback(std::move(_error), std::move(_blockHash));
+        };
+    }
+    _onGetBlock = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetBlockHashByNumber"), std::move(_onGetBlock));
+
     class Callback : public LedgerServicePrxCallback
     {
     public:
@@ -119,6 +212,29 @@ void LedgerServiceClient::asyncGetBlockHashByNumber(bcos::protocol::BlockNumber
 void LedgerServiceClient::asyncGetBlockNumberByHash(bcos::crypto::HashType const& _blockHash,
     std::function<void(bcos::Error::Ptr, bcos::protocol::BlockNumber)> _onGetBlock)
 {
+    if (m_blockNumberCache->enabled())
+    {
+        auto blockNumber = m_blockNumberCache->get(_blockHash);
+        if (blockNumber)
+        {
+            _onGetBlock(nullptr, *blockNumber);
+            return;
+        }
+        _onGetBlock = [blockHashCache = m_blockHashCache, blockNumberCache = m_blockNumberCache,
+                          _blockHash, callback = std::move(_onGetBlock)](
+                          bcos::Error::Ptr _error, bcos::protocol::BlockNumber _blockNumber) {
+            if (!_error && _blockNumber >= 0)
+            {
+                auto size = sizeof(_blockNumber) + bcos::crypto::HashType::size;
+                blockNumberCache->put(_blockHash, _blockNumber, size);
+                blockHashCache->put(_blockNumber, _blockHash, size);
+            }
+            callback(std::move(_error), _blockNumber);
+        };
+    }
+    _onGetBlock = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetBlockNumberByHash"), std::move(_onGetBlock));
+
     class Callback : public LedgerServicePrxCallback
     {
     public:
@@ -148,6 +264,9 @@ void LedgerServiceClient::asyncGetBatchTxsByHashList(bcos::crypto::HashListPtr _
         std::shared_ptr<std::map<std::string, bcos::ledger::MerkleProofPtr>>)>
         _onGetTx)
 {
+    _onGetTx = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetBatchTxsByHashList"), std::move(_onGetTx));
+
     class Callback : public LedgerServicePrxCallback
     {
     public:
@@ -211,6 +330,38 @@ void LedgerServiceClient::asyncGetTransactionReceiptByHash(bcos::crypto::HashTyp
         bcos::ledger::MerkleProofPtr)>
         _onGetTx)
 {
+    if (m_receiptCache->enabled())
+    {
+        auto cachedReceipt = m_receiptCache->get(_txHash);
+        // the receipt cached without proof can't answer the query with proof
+        if (cachedReceipt && (!_withProof || cachedReceipt->proof))
+        {
+            _onGetTx(nullptr, cachedReceipt->receipt,
+                _withProof ? cachedReceipt->proof : std::make_shared<bcos::ledger::MerkleProof>());
+            return;
+        }
+        _onGetTx = [receiptCache = m_receiptCache, _txHash, _withProof,
+                       callback = std::move(_onGetTx)](bcos::Error::Ptr _error,
+                       bcos::protocol::TransactionReceipt::ConstPtr _receipt,
+                       bcos::ledger::MerkleProofPtr _proof) {
+            if (!_error && _receipt)
+            {
+                auto size = receiptMemorySize(*_receipt);
+                CachedReceipt cachedReceipt{_receipt, nullptr};
+                if (_withProof)
+                {
+                    cachedReceipt.proof = _proof;
+                    size += proofMemorySize(_proof);
+                }
+                receiptCache->put(_txHash, std::move(cachedReceipt), size);
+            }
+            callback(std::move(_error), std::move(_receipt), std::move(_proof));
+        };
+    }
+    _onGetTx = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetTransactionReceiptByHash"),
+        std::move(_onGetTx));
+
     class Callback : public LedgerServicePrxCallback
     {
     public:
@@ -249,11 +400,248 @@ void LedgerServiceClient::asyncGetTransactionReceiptByHash(bcos::crypto::HashTyp
         new Callback(_onGetTx, m_cryptoSuite), txHash, _withProof);
 }
 
+void LedgerServiceClient::asyncGetBatchTxsWithBinaryProof(bcos::crypto::HashListPtr _txHashList,
+    std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr,
+        std::shared_ptr<MerkleProofViewMap>)>
+        _onGetTx)
+{
+    _onGetTx = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetBatchTxsWithBinaryProof"),
+        std::move(_onGetTx));
+
+    class Callback : public LedgerServicePrxCallback
+    {
+    public:
+        Callback(std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr,
+                     std::shared_ptr<MerkleProofViewMap>)>
+                     _callback,
+            bcos::crypto::CryptoSuite::Ptr _cryptoSuite)
+          : m_callback(_callback), m_cryptoSuite(_cryptoSuite)
+        {}
+
+        void callback_asyncGetBatchTxsByHashListV2(const bcostars::Error& ret,
+            const vector<bcostars::Transaction>& _txs,
+            const map<std::string, bcostars::MerkleProofBlob>& _merkleProofList) override
+        {
+            auto error = toBcosError(ret);
+            if (error)
+            {
+                m_callback(std::move(error), nullptr, nullptr);
+                return;
+            }
+            auto bcosTxsList = std::make_shared<bcos::protocol::Transactions>();
+            for (auto const& tx : _txs)
+            {
+                auto bcosTx = std::make_shared<bcostars::protocol::TransactionImpl>(
+                    m_cryptoSuite, [m_tx = std::move(tx)]() mutable { return &m_tx; });
+                bcosTxsList->emplace_back(bcosTx);
+            }
+            // move the received blobs into the views
+            auto proofList = std::make_shared<MerkleProofViewMap>();
+            auto& merkleProofList =
+                const_cast<map<std::string, bcostars::MerkleProofBlob>&>(_merkleProofList);
+            for (auto& it : merkleProofList)
+            {
+                auto proof =
+                    std::make_shared<bcostars::protocol::MerkleProofView>(std::move(it.second));
+                if (!proof->valid())
+                {
+                    m_callback(std::make_shared<bcos::Error>(-1, "invalid merkle proof"), nullptr,
+                        nullptr);
+                    return;
+                }
+                proofList->emplace(it.first, std::move(proof));
+            }
+            m_callback(nullptr, bcosTxsList, proofList);
+        }
+        void callback_asyncGetBatchTxsByHashListV2_exception(tars::Int32 ret) override
+        {
+            m_callback(toBcosError(ret), nullptr, nullptr);
+        }
+
+    private:
+        std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr,
+            std::shared_ptr<MerkleProofViewMap>)>
+            m_callback;
+        bcos::crypto::CryptoSuite::Ptr m_cryptoSuite;
+    };
+    std::vector<vector<tars::Char>> tarsTxsHashList;
+    tarsTxsHashList.reserve(_txHashList->size());
+    for (auto const& txHash : *_txHashList)
+    {
+        tarsTxsHashList.emplace_back(vector<tars::Char>(txHash.begin(), txHash.end()));
+    }
+    m_prx->async_asyncGetBatchTxsByHashListV2(
+        new Callback(_onGetTx, m_cryptoSuite), tarsTxsHashList, true);
+}
+
+void LedgerServiceClient::asyncGetBatchTxsAligned(bcos::crypto::HashListPtr _txHashList,
+    bool _withProof,
+    std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr,
+        std::shared_ptr<MerkleProofViewList>)>
+        _onGetTx)
+{
+    _onGetTx = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetBatchTxsAligned"), std::move(_onGetTx));
+
+    class Callback : public LedgerServicePrxCallback
+    {
+    public:
+        Callback(std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr,
+                     std::shared_ptr<MerkleProofViewList>)>
+                     _callback,
+            bcos::crypto::CryptoSuite::Ptr _cryptoSuite, size_t _requestedSize)
+          : m_callback(_callback), m_cryptoSuite(_cryptoSuite), m_requestedSize(_requestedSize)
+        {}
+
+        void callback_asyncGetBatchTxsByHashListAligned(const bcostars::Error& ret,
+            const vector<bcostars::Transaction>& _txs,
+            const vector<bcostars::MerkleProofBlob>& _proofs,
+            const vector<tars::Char>& _foundBitmap) override
+        {
+            auto error = toBcosError(ret);
+            if (error)
+            {
+                m_callback(std::move(error), nullptr, nullptr);
+                return;
+            }
+            if (_txs.size() != m_requestedSize ||
+                (!_proofs.empty() && _proofs.size() != m_requestedSize))
+            {
+                m_callback(std::make_shared<bcos::Error>(-1, "unaligned batch txs response"),
+                    nullptr, nullptr);
+                return;
+            }
+            auto& txs = const_cast<vector<bcostars::Transaction>&>(_txs);
+            auto& proofs = const_cast<vector<bcostars::MerkleProofBlob>&>(_proofs);
+            auto bcosTxsList = std::make_shared<bcos::protocol::Transactions>(m_requestedSize);
+            auto proofList = std::make_shared<MerkleProofViewList>(m_requestedSize);
+            for (size_t i = 0; i < m_requestedSize; ++i)
+            {
+                if (!bcostars::protocol::isPresent(_foundBitmap, i))
+                {
+                    continue;
+                }
+                (*bcosTxsList)[i] = std::make_shared<bcostars::protocol::TransactionImpl>(
+                    m_cryptoSuite, [m_tx = std::move(txs[i])]() mutable { return &m_tx; });
+                if (proofs.empty())
+                {
+                    continue;
+                }
+                auto proof =
+                    std::make_shared<bcostars::protocol::MerkleProofView>(std::move(proofs[i]));
+                if (!proof->valid())
+                {
+                    m_callback(std::make_shared<bcos::Error>(-1, "invalid merkle proof"), nullptr,
+                        nullptr);
+                    return;
+                }
+                (*proofList)[i] = std::move(proof);
+            }
+            m_callback(nullptr, bcosTxsList, proofList);
+        }
+        void callback_asyncGetBatchTxsByHashListAligned_exception(tars::Int32 ret) override
+        {
+            m_callback(toBcosError(ret), nullptr, nullptr);
+        }
+
+    private:
+        std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr,
+            std::shared_ptr<MerkleProofViewList>)>
+            m_callback;
+        bcos::crypto::CryptoSuite::Ptr m_cryptoSuite;
+        size_t m_requestedSize;
+    };
+    std::vector<vector<tars::Char>> tarsTxsHashList;
+    tarsTxsHashList.reserve(_txHashList->size());
+    for (auto const& txHash : *_txHashList)
+    {
+        tarsTxsHashList.emplace_back(vector<tars::Char>(txHash.begin(), txHash.end()));
+    }
+    m_prx->async_asyncGetBatchTxsByHashListAligned(
+        new Callback(_onGetTx, m_cryptoSuite, _txHashList->size()), tarsTxsHashList, _withProof);
+}
+
+void LedgerServiceClient::asyncGetTransactionReceiptWithBinaryProof(
+    bcos::crypto::HashType const& _txHash,
+    std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionReceipt::ConstPtr,
+        bcostars::protocol::MerkleProofView::Ptr)>
+        _onGetTx)
+{
+    _onGetTx = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetTransactionReceiptWithBinaryProof"),
+        std::move(_onGetTx));
+
+    class Callback : public LedgerServicePrxCallback
+    {
+    public:
+        Callback(std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionReceipt::ConstPtr,
+                     bcostars::protocol::MerkleProofView::Ptr)>
+                     _callback,
+            bcos::crypto::CryptoSuite::Ptr _cryptoSuite)
+          : m_callback(_callback), m_cryptoSuite(_cryptoSuite)
+        {}
+        void callback_asyncGetTransactionReceiptByHashV2(const bcostars::Error& ret,
+            const bcostars::TransactionReceipt& _receipt,
+            const bcostars::MerkleProofBlob& _proof) override
+        {
+            auto error = toBcosError(ret);
+            if (error)
+            {
+                m_callback(std::move(error), nullptr, nullptr);
+                return;
+            }
+            auto bcosReceipt = std::make_shared<bcostars::protocol::TransactionReceiptImpl>(
+                m_cryptoSuite, [m_receipt = std::move(_receipt)]() mutable { return &m_receipt; });
+            auto proof = std::make_shared<bcostars::protocol::MerkleProofView>(
+                std::move(const_cast<bcostars::MerkleProofBlob&>(_proof)));
+            if (!proof->valid())
+            {
+                m_callback(std::make_shared<bcos::Error>(-1, "invalid merkle proof"), nullptr,
+                    nullptr);
+                return;
+            }
+            m_callback(nullptr, bcosReceipt, proof);
+        }
+        void callback_asyncGetTransactionReceiptByHashV2_exception(tars::Int32 ret) override
+        {
+            m_callback(toBcosError(ret), nullptr, nullptr);
+        }
+
+    private:
+        std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionReceipt::ConstPtr,
+            bcostars::protocol::MerkleProofView::Ptr)>
+            m_callback;
+        bcos::crypto::CryptoSuite::Ptr m_cryptoSuite;
+    };
+    std::vector<tars::Char> txHash(_txHash.begin(), _txHash.end());
+    m_prx->async_asyncGetTransactionReceiptByHashV2(
+        new Callback(_onGetTx, m_cryptoSuite), txHash, true);
+}
+
 void LedgerServiceClient::asyncGetTotalTransactionCount(
     std::function<void(bcos::Error::Ptr, int64_t _totalTxCount, int64_t _failedTxCount,
         bcos::protocol::BlockNumber _latestBlockNumber)>
         _callback)
 {
+    if (configCacheEnabled())
+    {
+        _callback = [systemConfigCache = m_systemConfigCache, nodeListCache = m_nodeListCache,
+                        callback = std::move(_callback)](bcos::Error::Ptr _error,
+                        int64_t _totalTxCount, int64_t _failedTxCount,
+                        bcos::protocol::BlockNumber _latestBlockNumber) {
+            if (!_error)
+            {
+                systemConfigCache->notifyBlockNumber(_latestBlockNumber);
+                nodeListCache->notifyBlockNumber(_latestBlockNumber);
+            }
+            callback(std::move(_error), _totalTxCount, _failedTxCount, _latestBlockNumber);
+        };
+    }
+    _callback = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetTotalTransactionCount"),
+        std::move(_callback));
+
     class Callback : public LedgerServicePrxCallback
     {
     public:
@@ -284,6 +672,29 @@ void LedgerServiceClient::asyncGetTotalTransactionCount(
 void LedgerServiceClient::asyncGetSystemConfigByKey(std::string const& _key,
     std::function<void(bcos::Error::Ptr, std::string, bcos::protocol::BlockNumber)> _onGetConfig)
 {
+    if (m_systemConfigCache->enabled())
+    {
+        auto config = m_systemConfigCache->get(_key);
+        if (config)
+        {
+            _onGetConfig(nullptr, config->first, config->second);
+            return;
+        }
+        _onGetConfig = [systemConfigCache = m_systemConfigCache, _key,
+                           queriedBlockNumber = m_systemConfigCache->latestBlockNumber(),
+                           callback = std::move(_onGetConfig)](bcos::Error::Ptr _error,
+                           std::string _value, bcos::protocol::BlockNumber _blockNumber) {
+            if (!_error)
+            {
+                systemConfigCache->put(
+                    _key, std::make_pair(_value, _blockNumber), queriedBlockNumber);
+            }
+            callback(std::move(_error), std::move(_value), _blockNumber);
+        };
+    }
+    _onGetConfig = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetSystemConfigByKey"), std::move(_onGetConfig));
+
     class Callback : public LedgerServicePrxCallback
     {
     public:
@@ -310,6 +721,31 @@ void LedgerServiceClient::asyncGetSystemConfigByKey(std::string const& _key,
 void LedgerServiceClient::asyncGetNodeListByType(std::string const& _type,
     std::function<void(bcos::Error::Ptr, bcos::consensus::ConsensusNodeListPtr)> _onGetConfig)
 {
+    if (m_nodeListCache->enabled())
+    {
+        auto nodeList = m_nodeListCache->get(_type);
+        if (nodeList)
+        {
+            // the caller may modify the returned list
+            _onGetConfig(nullptr, std::make_shared<bcos::consensus::ConsensusNodeList>(**nodeList));
+            return;
+        }
+        _onGetConfig = [nodeListCache = m_nodeListCache, _type,
+                           queriedBlockNumber = m_nodeListCache->latestBlockNumber(),
+                           callback = std::move(_onGetConfig)](bcos::Error::Ptr _error,
+                           bcos::consensus::ConsensusNodeListPtr _nodeList) {
+            if (!_error && _nodeList)
+            {
+                nodeListCache->put(_type,
+                    std::make_shared<bcos::consensus::ConsensusNodeList>(*_nodeList),
+                    queriedBlockNumber);
+            }
+            callback(std::move(_error), std::move(_nodeList));
+        };
+    }
+    _onGetConfig = instrumentCallback(
+        BCOS_CLIENT_METRICS("LedgerService", "asyncGetNodeListByType"), std::move(_onGetConfig));
+
     class Callback : public LedgerServicePrxCallback
     {
     public:
@@ -334,3 +770,159 @@ void LedgerServiceClient::asyncGetNodeListByType(std::string const& _type,
     };
     m_prx->async_asyncGetNodeListByType(new Callback(_onGetConfig, m_keyFactory), _type);
 }
+
+void LedgerServiceClient::asyncGetBlockDataByRange(bcos::protocol::BlockNumber _startNumber,
+    int64_t _count, int32_t _blockFlag, std::function<void(std::shared_ptr<BlockList>)> _onChunk,
+    std::function<void(bcos::Error::Ptr, int64_t)> _onFinished, int64_t _chunkSize,
+    size_t _maxInflightChunks)
+{
+    class Callback : public LedgerServicePrxCallback
+    {
+    public:
+        Callback(BlockRangeFetcher::ChunkCallback _callback,
+            bcos::protocol::BlockFactory::Ptr _blockFactory)
+          : m_callback(std::move(_callback)), m_blockFactory(_blockFactory)
+        {}
+        void callback_asyncGetBlockDataByRange(
+            const bcostars::Error& ret, const vector<bcostars::Block>& _blocks) override
+        {
+            auto blocks = std::make_shared<BlockList>();
+            blocks->reserve(_blocks.size());
+            auto& tarsBlocks = const_cast<vector<bcostars::Block>&>(_blocks);
+            for (auto& tarsBlock : tarsBlocks)
+            {
+                auto bcosBlock = m_blockFactory->createBlock();
+                std::dynamic_pointer_cast<bcostars::protocol::BlockImpl>(bcosBlock)->setInner(
+                    std::move(tarsBlock));
+                blocks->emplace_back(std::move(bcosBlock));
+            }
+            m_callback(toBcosError(ret), std::move(blocks));
+        }
+        void callback_asyncGetBlockDataByRange_exception(tars::Int32 ret) override
+        {
+            m_callback(toBcosError(ret), nullptr);
+        }
+
+    private:
+        BlockRangeFetcher::ChunkCallback m_callback;
+        bcos::protocol::BlockFactory::Ptr m_blockFactory;
+    };
+
+    auto requestChunk = [prx = m_prx, blockFactory = m_blockFactory, _blockFlag](
+                            int64_t _chunkStart, int64_t _chunkCount,
+                            BlockRangeFetcher::ChunkCallback _callback) {
+        _callback = instrumentCallback(
+            BCOS_CLIENT_METRICS("LedgerService", "asyncGetBlockDataByRange"), std::move(_callback));
+        prx->async_asyncGetBlockDataByRange(
+            new Callback(std::move(_callback), blockFactory), _chunkStart, _chunkCount, _blockFlag);
+    };
+    auto fetcher = std::make_shared<BlockRangeFetcher>(std::move(requestChunk), _startNumber,
+        _count, _chunkSize, _maxInflightChunks, std::move(_onChunk), std::move(_onFinished));
+    fetcher->start();
+}
+
+void LedgerServiceClient::asyncGetBlockDataByNumberChunked(bcos::protocol::BlockNumber _blockNumber,
+    int32_t _blockFlag,
+    std::function<void(bcos::Error::Ptr, bcos::protocol::Block::Ptr)> _onGetBlock,
+    size_t _chunkSize, int64_t _maxBlockSize)
+{
+    _onGetBlock =
+        instrumentCallback(BCOS_CLIENT_METRICS("LedgerService", "asyncGetBlockDataByNumberChunked"),
+            std::move(_onGetBlock));
+
+    using ChunkCallback = std::function<void(bcos::Error::Ptr, bcostars::BlockChunk const&)>;
+    class Callback : public LedgerServicePrxCallback
+    {
+    public:
+        Callback(ChunkCallback _callback) : m_callback(std::move(_callback)) {}
+        void callback_asyncGetBlockChunkByNumber(
+            const bcostars::Error& ret, const bcostars::BlockChunk& _chunk) override
+        {
+            m_callback(toBcosError(ret), _chunk);
+        }
+        void callback_asyncGetBlockChunkByNumber_exception(tars::Int32 ret) override
+        {
+            m_callback(toBcosError(ret), bcostars::BlockChunk());
+        }
+
+    private:
+        ChunkCallback m_callback;
+    };
+
+    // Note: shared with the response callbacks, the next chunk is requested once the previous
+    // one is appended
+    struct ChunkedFetch : public std::enable_shared_from_this<ChunkedFetch>
+    {
+        bcostars::LedgerServicePrx prx;
+        bcos::protocol::BlockFactory::Ptr blockFactory;
+        bcos::protocol::BlockNumber blockNumber;
+        int32_t blockFlag;
+        size_t chunkSize;
+        int64_t maxBlockSize;
+        std::function<void(bcos::Error::Ptr, bcos::protocol::Block::Ptr)> callback;
+        bcostars::protocol::BlockAssembler::Ptr assembler;
+
+        void fetch(int64_t _offset)
+        {
+            prx->async_asyncGetBlockChunkByNumber(
+                new Callback([self = shared_from_this()](bcos::Error::Ptr _error,
+                                 bcostars::BlockChunk const& _chunk) {
+                    self->onChunk(std::move(_error), _chunk);
+                }),
+                blockNumber, blockFlag, _offset, (int64_t)chunkSize);
+        }
+
+        void onChunk(bcos::Error::Ptr _error, bcostars::BlockChunk const& _chunk)
+        {
+            if (_error)
+            {
+                callback(std::move(_error), nullptr);
+                return;
+            }
+            if (!assembler)
+            {
+                assembler = bcostars::protocol::BlockAssembler::create(
+                    _chunk.transferID, _chunk.totalSize, maxBlockSize);
+                if (!assembler)
+                {
+                    callback(std::make_shared<bcos::Error>(-1,
+                                 "invalid block size " + std::to_string(_chunk.totalSize)),
+                        nullptr);
+                    return;
+                }
+            }
+            // an empty chunk before the end means the servant can't make progress
+            if (!assembler->append(_chunk) || (_chunk.data.empty() && !assembler->complete()))
+            {
+                callback(std::make_shared<bcos::Error>(-1, "invalid block chunk"), nullptr);
+                return;
+            }
+            if (!assembler->complete())
+            {
+                fetch(assembler->receivedSize());
+                return;
+            }
+            bcos::protocol::Block::Ptr block;
+            try
+            {
+                block = assembler->decode(*blockFactory, false, false);
+            }
+            catch (std::exception const& e)
+            {
+                callback(std::make_shared<bcos::Error>(-1, e.what()), nullptr);
+                return;
+            }
+            assembler.reset();
+            callback(nullptr, std::move(block));
+        }
+    };
+    auto chunkedFetch = std::make_shared<ChunkedFetch>();
+    chunkedFetch->prx = m_prx;
+    chunkedFetch->blockFactory = m_blockFactory;
+    chunkedFetch->blockNumber = _blockNumber;
+    chunkedFetch->blockFlag = _blockFlag;
+    chunkedFetch->chunkSize = std::max<size_t>(_chunkSize, 1);
+    chunkedFetch->maxBlockSize = _maxBlockSize;
+    chunkedFetch->callback = std::move(_onGetBlock);
+    chunkedFetch->fetch(0);
+}
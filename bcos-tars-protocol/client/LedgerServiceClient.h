@@ -18,6 +18,10 @@
  * @date 2021-10-17
  */
 #pragma once
+#include "bcos-tars-protocol/client/BlockTaggedCache.h"
+#include "bcos-tars-protocol/client/LRUCache.h"
+#include "bcos-tars-protocol/protocol/BlockChunk.h"
+#include "bcos-tars-protocol/protocol/MerkleProofView.h"
 #include "bcos-tars-protocol/tars/LedgerService.h"
 #include <bcos-framework/interfaces/ledger/LedgerInterface.h>
 #include <bcos-framework/interfaces/protocol/BlockFactory.h>
@@ -75,6 +79,26 @@ public:
             bcos::ledger::MerkleProofPtr)>
             _onGetTx) override;
 
+    // the same as asyncGetBatchTxsByHashList and asyncGetTransactionReceiptByHash with proof, the
+    // proofs are views over the received binary proofs, no sibling is copied or hex-encoded
+    using MerkleProofViewMap = std::map<std::string, bcostars::protocol::MerkleProofView::Ptr>;
+    void asyncGetBatchTxsWithBinaryProof(bcos::crypto::HashListPtr _txHashList,
+        std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr,
+            std::shared_ptr<MerkleProofViewMap>)>
+            _onGetTx);
+    void asyncGetTransactionReceiptWithBinaryProof(bcos::crypto::HashType const& _txHash,
+        std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionReceipt::ConstPtr,
+            bcostars::protocol::MerkleProofView::Ptr)>
+            _onGetTx);
+
+    // the transactions and the proofs are returned in the order of _txHashList, the transaction
+    // and the proof of the missing one are null; the proofs are null if queried without proof
+    using MerkleProofViewList = std::vector<bcostars::protocol::MerkleProofView::Ptr>;
+    void asyncGetBatchTxsAligned(bcos::crypto::HashListPtr _txHashList, bool _withProof,
+        std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr,
+            std::shared_ptr<MerkleProofViewList>)>
+            _onGetTx);
+
     void asyncGetTotalTransactionCount(std::function<void(bcos::Error::Ptr, int64_t _totalTxCount,
             int64_t _failedTxCount, bcos::protocol::BlockNumber _latestBlockNumber)>
             _callback) override;
@@ -87,6 +111,33 @@ public:
         std::function<void(bcos::Error::Ptr, bcos::consensus::ConsensusNodeListPtr)> _onGetConfig)
         override;
 
+    using BlockList = std::vector<bcos::protocol::Block::Ptr>;
+    static constexpr int64_t c_defaultRangeChunkSize = 64;
+    static constexpr size_t c_defaultRangeInflightChunks = 4;
+    // fetch the blocks [_startNumber, _startNumber + _count) in chunks of at most _chunkSize
+    // blocks, with at most _maxInflightChunks chunks requested at the same time;
+    // every chunk is decoded on arrival and passed to _onChunk in the block number order,
+    // _onFinished is called with the number of the fetched blocks once the range is fetched, the
+    // latest block is reached or an error occurs
+    void asyncGetBlockDataByRange(bcos::protocol::BlockNumber _startNumber, int64_t _count,
+        int32_t _blockFlag, std::function<void(std::shared_ptr<BlockList>)> _onChunk,
+        std::function<void(bcos::Error::Ptr, int64_t)> _onFinished,
+        int64_t _chunkSize = c_defaultRangeChunkSize,
+        size_t _maxInflightChunks = c_defaultRangeInflightChunks);
+
+    // fetch the oversized block in chunks of at most _chunkSize encoded bytes, the chunks are
+    // fetched one after another and written into a buffer of the encoded block size, so neither
+    // side holds the whole block in a single tars packet; the blocks encoded in more than
+    // _maxBlockSize bytes are rejected before the buffer is allocated
+    // Note: this bounds the packet size only, not the peak memory: the client still holds the
+    // whole encoded block and then the decoded one; the servant should keep the encoded block
+    // for the transfer, e.g. in a BlockChunkerCache, instead of encoding it for every chunk
+    void asyncGetBlockDataByNumberChunked(bcos::protocol::BlockNumber _blockNumber,
+        int32_t _blockFlag,
+        std::function<void(bcos::Error::Ptr, bcos::protocol::Block::Ptr)> _onGetBlock,
+        size_t _chunkSize = bcostars::protocol::c_defaultBlockChunkSize,
+        int64_t _maxBlockSize = bcostars::protocol::c_defaultMaxBlockSize);
+
     // TODO: implement this
     void asyncGetNonceList(bcos::protocol::BlockNumber, int64_t,
         std::function<void(bcos::Error::Ptr,
@@ -96,10 +147,66 @@ public:
         BCOS_LOG(ERROR) << LOG_DESC("unimplement method asyncGetNonceList");
     }
 
+    // cache the committed block hashes, block numbers and receipts which never change, the
+    // capacities are in bytes and zero disables the cache
+    void setImmutableCacheCapacity(size_t _blockIndexCapacity, size_t _receiptCapacity)
+    {
+        m_blockHashCache->setCapacity(_blockIndexCapacity / 2);
+        m_blockNumberCache->setCapacity(_blockIndexCapacity / 2);
+        m_receiptCache->setCapacity(_receiptCapacity);
+    }
+    CacheStats blockHashCacheStats() const { return m_blockHashCache->stats(); }
+    CacheStats blockNumberCacheStats() const { return m_blockNumberCache->stats(); }
+    CacheStats receiptCacheStats() const { return m_receiptCache->stats(); }
+
+    // cache the system configs and the node lists until a newer block is observed, the block
+    // number is observed from asyncGetBlockNumber, asyncGetTotalTransactionCount and
+    // notifyBlockNumber, which should be called once a block is committed
+    void setConfigCacheEnabled(bool _enabled)
+    {
+        m_systemConfigCache->setEnabled(_enabled);
+        m_nodeListCache->setEnabled(_enabled);
+    }
+    void notifyBlockNumber(bcos::protocol::BlockNumber _blockNumber)
+    {
+        m_systemConfigCache->notifyBlockNumber(_blockNumber);
+        m_nodeListCache->notifyBlockNumber(_blockNumber);
+    }
+    CacheStats systemConfigCacheStats() const { return m_systemConfigCache->stats(); }
+    CacheStats nodeListCacheStats() const { return m_nodeListCache->stats(); }
+
 private:
+    struct CachedReceipt
+    {
+        bcos::protocol::TransactionReceipt::ConstPtr receipt;
+        // null if the receipt is queried without proof
+        bcos::ledger::MerkleProofPtr proof;
+    };
+    using BlockHashCache = LRUCache<bcos::protocol::BlockNumber, bcos::crypto::HashType>;
+    using BlockNumberCache = LRUCache<bcos::crypto::HashType, bcos::protocol::BlockNumber,
+        LeadingBytesHasher<bcos::crypto::HashType>>;
+    using ReceiptCache =
+        LRUCache<bcos::crypto::HashType, CachedReceipt, LeadingBytesHasher<bcos::crypto::HashType>>;
+    // the config value and its enable number
+    using SystemConfigCache =
+        BlockTaggedCache<std::pair<std::string, bcos::protocol::BlockNumber>>;
+    using NodeListCache = BlockTaggedCache<bcos::consensus::ConsensusNodeListPtr>;
+
+    bool configCacheEnabled() const
+    {
+        return m_systemConfigCache->enabled() || m_nodeListCache->enabled();
+    }
+
     bcostars::LedgerServicePrx m_prx;
     bcos::protocol::BlockFactory::Ptr m_blockFactory;
     bcos::crypto::CryptoSuite::Ptr m_cryptoSuite;
     bcos::crypto::KeyFactory::Ptr m_keyFactory;
+
+    // Note: the caches are shared with the pending response callbacks
+    std::shared_ptr<BlockHashCache> m_blockHashCache = std::make_shared<BlockHashCache>();
+    std::shared_ptr<BlockNumberCache> m_blockNumberCache = std::make_shared<BlockNumberCache>();
+    std::shared_ptr<ReceiptCache> m_receiptCache = std::make_shared<ReceiptCache>();
+    std::shared_ptr<SystemConfigCache> m_systemConfigCache = std::make_shared<SystemConfigCache>();
+    std::shared_ptr<NodeListCache> m_nodeListCache = std::make_shared<NodeListCache>();
 };
 }  // namespace bcostars
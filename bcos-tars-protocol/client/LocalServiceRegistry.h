@@ -0,0 +1,100 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the in-process transport of the co-located services
+ * @file LocalServiceRegistry.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+namespace bcostars
+{
+enum class ServiceTransport : uint8_t
+{
+    // encode the requests and send them to the servants through the tars proxies
+    Tars = 0,
+    // call the implementations registered in this process directly
+    InProcess = 1,
+};
+
+// the implementations of the services running in this process, keyed by the service interface,
+// e.g. bcos::txpool::TxPoolInterface; the calls dispatched to them pass the protocol objects by
+// shared pointer, without encoding, decoding or the servant stack
+class LocalServiceRegistry
+{
+public:
+    static LocalServiceRegistry& instance()
+    {
+        static LocalServiceRegistry s_instance;
+        return s_instance;
+    }
+
+    template <typename Interface>
+    void registerService(std::shared_ptr<Interface> _service)
+    {
+        std::lock_guard<std::mutex> lock(x_services);
+        m_services[typeid(Interface)] = std::move(_service);
+    }
+
+    template <typename Interface>
+    void unregisterService()
+    {
+        std::lock_guard<std::mutex> lock(x_services);
+        m_services.erase(typeid(Interface));
+    }
+
+    template <typename Interface>
+    std::shared_ptr<Interface> service() const
+    {
+        std::lock_guard<std::mutex> lock(x_services);
+        auto it = m_services.find(typeid(Interface));
+        if (it == m_services.end())
+        {
+            return nullptr;
+        }
+        return std::static_pointer_cast<Interface>(it->second);
+    }
+
+private:
+    LocalServiceRegistry() = default;
+
+    std::unordered_map<std::type_index, std::shared_ptr<void>> m_services;
+    mutable std::mutex x_services;
+};
+
+// creates the client of the service by _createTarsClient, unless the in-process transport is
+// chosen and the implementation of the service is registered, e.g.
+// createServiceClient<bcos::txpool::TxPoolInterface>(transport, [proxy]() {
+//     return std::make_shared<TxPoolServiceClient>(proxy); });
+template <typename Interface, typename CreateTarsClient>
+std::shared_ptr<Interface> createServiceClient(
+    ServiceTransport _transport, CreateTarsClient&& _createTarsClient)
+{
+    if (_transport == ServiceTransport::InProcess)
+    {
+        if (auto service = LocalServiceRegistry::instance().service<Interface>())
+        {
+            return service;
+        }
+    }
+    return _createTarsClient();
+}
+}  // namespace bcostars
@@ -21,21 +21,34 @@
 
 #include "PBFTServiceClient.h"
 #include "bcos-tars-protocol/Common.h"
+#include "bcos-tars-protocol/client/ClientMetrics.h"
+#include "bcos-tars-protocol/client/ClientTrace.h"
 #include "bcos-tars-protocol/protocol/BlockFactoryImpl.h"
+#include <random>
 using namespace bcostars;
 
 void PBFTServiceClient::asyncSubmitProposal(bool _containSysTxs, bcos::bytesConstRef _proposalData,
     bcos::protocol::BlockNumber _proposalIndex, bcos::crypto::HashType const& _proposalHash,
     std::function<void(bcos::Error::Ptr)> _onProposalSubmitted)
 {
+    _onProposalSubmitted = instrumentCallback(
+        BCOS_CLIENT_METRICS("PBFTService", "asyncSubmitProposal"),
+        std::move(_onProposalSubmitted), _proposalData.size());
+    auto span = ClientTracer::instance().startSpan("PBFTService", "asyncSubmitProposal");
+    _onProposalSubmitted = span.wrap(std::move(_onProposalSubmitted));
+
     m_proxy->async_asyncSubmitProposal(new PBFTServiceCommonCallback(_onProposalSubmitted),
         _containSysTxs, std::vector<char>(_proposalData.begin(), _proposalData.end()),
-        _proposalIndex, std::vector<char>(_proposalHash.begin(), _proposalHash.end()));
+        _proposalIndex, std::vector<char>(_proposalHash.begin(), _proposalHash.end()),
+        span.context());
 }
 
 void PBFTServiceClient::asyncGetPBFTView(
     std::function<void(bcos::Error::Ptr, bcos::consensus::ViewType)> _onGetView)
 {
+    _onGetView = instrumentCallback(
+        BCOS_CLIENT_METRICS("PBFTService", "asyncGetPBFTView"), std::move(_onGetView));
+
     class Callback : public PBFTServicePrxCallback
     {
     public:
@@ -64,6 +77,17 @@ void PBFTServiceClient::asyncGetPBFTView(
 void PBFTServiceClient::asyncCheckBlock(
     bcos::protocol::Block::Ptr _block, std::function<void(bcos::Error::Ptr, bool)> _onVerifyFinish)
 {
+    auto chunkSize = m_blockChunkSize.load();
+    if (chunkSize > 0)
+    {
+        asyncCheckBlockChunked(std::move(_block), std::move(_onVerifyFinish), chunkSize);
+        return;
+    }
+    _onVerifyFinish = instrumentCallback(
+        BCOS_CLIENT_METRICS("PBFTService", "asyncCheckBlock"), std::move(_onVerifyFinish));
+    auto span = ClientTracer::instance().startSpan("PBFTService", "asyncCheckBlock");
+    _onVerifyFinish = span.wrap(std::move(_onVerifyFinish));
+
     class Callback : public PBFTServicePrxCallback
     {
     public:
@@ -86,13 +110,83 @@ void PBFTServiceClient::asyncCheckBlock(
     };
 
     auto blockImpl = std::dynamic_pointer_cast<bcostars::protocol::BlockImpl>(_block);
-    m_proxy->async_asyncCheckBlock(new Callback(_onVerifyFinish), blockImpl->inner());
+    m_proxy->async_asyncCheckBlock(
+        new Callback(_onVerifyFinish), blockImpl->inner(), span.context());
+}
+
+void PBFTServiceClient::asyncCheckBlockChunked(bcos::protocol::Block::Ptr _block,
+    std::function<void(bcos::Error::Ptr, bool)> _onVerifyFinish, size_t _chunkSize)
+{
+    _onVerifyFinish = instrumentCallback(
+        BCOS_CLIENT_METRICS("PBFTService", "asyncCheckBlockChunked"), std::move(_onVerifyFinish));
+    auto span = ClientTracer::instance().startSpan("PBFTService", "asyncCheckBlockChunked");
+    _onVerifyFinish = span.wrap(std::move(_onVerifyFinish));
+
+    class Callback : public PBFTServicePrxCallback
+    {
+    public:
+        explicit Callback(std::function<void(bcos::Error::Ptr, bool)> _callback)
+          : PBFTServicePrxCallback(), m_callback(_callback)
+        {}
+        ~Callback() override {}
+
+        void callback_asyncCheckBlockChunk(
+            const bcostars::Error& ret, tars::Bool _verifyResult) override
+        {
+            m_callback(toBcosError(ret), _verifyResult);
+        }
+        void callback_asyncCheckBlockChunk_exception(tars::Int32 ret) override
+        {
+            m_callback(toBcosError(ret), false);
+        }
+
+    private:
+        std::function<void(bcos::Error::Ptr, bool)> m_callback;
+    };
+
+    // Note: shared with the response callbacks, the next chunk is sent once the previous one is
+    // acknowledged, so only one chunk is copied out of the encoded block at a time
+    struct ChunkedCheck : public std::enable_shared_from_this<ChunkedCheck>
+    {
+        bcostars::PBFTServicePrx proxy;
+        std::unique_ptr<bcostars::protocol::BlockChunker> chunker;
+        std::function<void(bcos::Error::Ptr, bool)> callback;
+        std::map<std::string, std::string> context;
+
+        void send(size_t _index)
+        {
+            proxy->async_asyncCheckBlockChunk(
+                new Callback([self = shared_from_this(), _index](
+                                 bcos::Error::Ptr _error, bool _verifyResult) {
+                    if (_error || _index + 1 == self->chunker->chunkCount())
+                    {
+                        self->callback(std::move(_error), _verifyResult);
+                        return;
+                    }
+                    self->send(_index + 1);
+                }),
+                chunker->chunk(_index), context);
+        }
+    };
+    // the receiver assembles the chunks by the transferID, which must not collide with the
+    // concurrent transfers from the other clients
+    thread_local std::mt19937_64 s_transferIDGenerator(std::random_device{}());
+    auto chunkedCheck = std::make_shared<ChunkedCheck>();
+    chunkedCheck->proxy = m_proxy;
+    chunkedCheck->chunker = std::make_unique<bcostars::protocol::BlockChunker>(
+        _block, (int64_t)(s_transferIDGenerator() >> 1), _chunkSize);
+    chunkedCheck->callback = std::move(_onVerifyFinish);
+    chunkedCheck->context = span.context();
+    chunkedCheck->send(0);
 }
 
 // the sync module calls this interface to notify new block
 void PBFTServiceClient::asyncNotifyNewBlock(
     bcos::ledger::LedgerConfig::Ptr _ledgerConfig, std::function<void(bcos::Error::Ptr)> _onRecv)
 {
+    _onRecv = instrumentCallback(
+        BCOS_CLIENT_METRICS("PBFTService", "asyncNotifyNewBlock"), std::move(_onRecv));
+
     m_proxy->async_asyncNotifyNewBlock(
         new PBFTServiceCommonCallback(_onRecv), toTarsLedgerConfig(_ledgerConfig));
 }
@@ -102,6 +196,10 @@ void PBFTServiceClient::asyncNotifyConsensusMessage(bcos::Error::Ptr, std::strin
     bcos::crypto::NodeIDPtr _nodeID, bcos::bytesConstRef _data,
     std::function<void(bcos::Error::Ptr _error)> _onRecv)
 {
+    _onRecv = instrumentCallback(
+        BCOS_CLIENT_METRICS("PBFTService", "asyncNotifyConsensusMessage"),
+        std::move(_onRecv), _data.size());
+
     auto nodeIDData = _nodeID->data();
     m_proxy->async_asyncNotifyConsensusMessage(new PBFTServiceCommonCallback(_onRecv), _uuid,
         std::vector<char>(nodeIDData.begin(), nodeIDData.end()),
@@ -112,6 +210,9 @@ void PBFTServiceClient::asyncNotifyConsensusMessage(bcos::Error::Ptr, std::strin
 void PBFTServiceClient::asyncNoteUnSealedTxsSize(
     size_t _unsealedTxsSize, std::function<void(bcos::Error::Ptr)> _onRecv)
 {
+    _onRecv = instrumentCallback(
+        BCOS_CLIENT_METRICS("PBFTService", "asyncNoteUnSealedTxsSize"), std::move(_onRecv));
+
     m_proxy->async_asyncNoteUnSealedTxsSize(
         new PBFTServiceCommonCallback(_onRecv), _unsealedTxsSize);
 }
@@ -119,6 +220,9 @@ void PBFTServiceClient::asyncNoteUnSealedTxsSize(
 void BlockSyncServiceClient::asyncGetSyncInfo(
     std::function<void(bcos::Error::Ptr, std::string)> _onGetSyncInfo)
 {
+    _onGetSyncInfo = instrumentCallback(
+        BCOS_CLIENT_METRICS("PBFTService", "asyncGetSyncInfo"), std::move(_onGetSyncInfo));
+
     class Callback : public PBFTServicePrxCallback
     {
     public:
@@ -152,6 +256,9 @@ void BlockSyncServiceClient::notifyConnectedNodes(bcos::crypto::NodeIDSet const&
 void PBFTServiceClient::notifyConnectedNodes(bcos::crypto::NodeIDSet const& _connectedNodes,
     std::function<void(bcos::Error::Ptr)> _onResponse)
 {
+    _onResponse = instrumentCallback(
+        BCOS_CLIENT_METRICS("PBFTService", "notifyConnectedNodes"), std::move(_onResponse));
+
     class Callback : public bcostars::PBFTServicePrxCallback
     {
     public:
@@ -183,6 +290,10 @@ void PBFTServiceClient::notifyConnectedNodes(bcos::crypto::NodeIDSet const& _con
 void PBFTServiceClient::asyncGetConsensusStatus(
     std::function<void(bcos::Error::Ptr, std::string)> _onGetConsensusStatus)
 {
+    _onGetConsensusStatus = instrumentCallback(
+        BCOS_CLIENT_METRICS("PBFTService", "asyncGetConsensusStatus"),
+        std::move(_onGetConsensusStatus));
+
     class Callback : public PBFTServicePrxCallback
     {
     public:
@@ -23,9 +23,12 @@
 
 #include "bcos-framework/interfaces/sealer/SealerInterface.h"
 #include "bcos-tars-protocol/ErrorConverter.h"
+#include "bcos-tars-protocol/client/ClientMetrics.h"
+#include "bcos-tars-protocol/protocol/BlockChunk.h"
 #include "bcos-tars-protocol/tars/PBFTService.h"
 #include <bcos-framework/interfaces/consensus/ConsensusInterface.h>
 #include <bcos-framework/interfaces/sync/BlockSyncInterface.h>
+#include <atomic>
 
 namespace bcostars
 {
@@ -118,6 +121,16 @@ public:
     void asyncCheckBlock(bcos::protocol::Block::Ptr _block,
         std::function<void(bcos::Error::Ptr, bool)> _onVerifyFinish) override;
 
+    // send the oversized block in chunks of at most _chunkSize encoded bytes, the next chunk is
+    // sent once the previous one is acknowledged, and the verify result of the last chunk is
+    // returned
+    void asyncCheckBlockChunked(bcos::protocol::Block::Ptr _block,
+        std::function<void(bcos::Error::Ptr, bool)> _onVerifyFinish,
+        size_t _chunkSize = bcostars::protocol::c_defaultBlockChunkSize);
+    // asyncCheckBlock sends the block in chunks of _chunkSize bytes if it is set, zero sends the
+    // whole block in one request
+    void setBlockChunkSize(size_t _chunkSize) { m_blockChunkSize = _chunkSize; }
+
     // the sync module calls this interface to notify new block
     // Note: if the sync module integrates with the PBFT module, no need to implement this interface
     void asyncNotifyNewBlock(bcos::ledger::LedgerConfig::Ptr _ledgerConfig,
@@ -157,6 +170,7 @@ public:
 
 protected:
     bcostars::PBFTServicePrx m_proxy;
+    std::atomic<size_t> m_blockChunkSize = {0};
 };
 
 class BlockSyncServiceClient : virtual public bcos::sync::BlockSyncInterface,
@@ -186,6 +200,10 @@ public:
         bcos::crypto::NodeIDPtr _nodeID, bcos::bytesConstRef _data,
         std::function<void(bcos::Error::Ptr _error)> _onRecv) override
     {
+        _onRecv = instrumentCallback(
+            BCOS_CLIENT_METRICS("PBFTService", "asyncNotifyBlockSyncMessage"),
+            std::move(_onRecv), _data.size());
+
         auto nodeIDData = _nodeID->data();
         m_proxy->async_asyncNotifyBlockSyncMessage(new PBFTServiceCommonCallback(_onRecv), _uuid,
             std::vector<char>(nodeIDData.begin(), nodeIDData.end()),
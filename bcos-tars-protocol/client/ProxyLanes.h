@@ -0,0 +1,199 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief route the requests to the proxies of different priorities
+ * @file ProxyLanes.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/client/ConnectionStatus.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace bcostars
+{
+// the latency sensitive consensus messages use their own lane, so they don't queue behind the
+// bulk sync transfers on the same connection
+enum class ProxyLane : uint8_t
+{
+    Consensus = 0,
+    Default = 1,
+    Bulk = 2,
+};
+constexpr size_t c_proxyLaneCount = 3;
+
+// every lane is served by its own proxy, which should connect to the service through a separate
+// connection, e.g. another obj name or endpoint of the same servant, and the connection of every
+// lane proxy is checked by its own ConnectionStatus; the lanes without proxy fall back to the
+// current default lane, and the requests are routed to the lanes by the moduleID or the method
+// name; the routes are replaced as a whole, so they can be changed while sending, and routing is
+// an atomic pointer load and a lookup without allocation; the replaced routes and lanes are kept
+// until the ProxyLanes is destroyed, they are configured when the client is set up so they are few
+template <typename Prx>
+class ProxyLanes
+{
+public:
+    struct Lane
+    {
+        Prx proxy;
+        ConnectionStatus::Ptr status;
+    };
+    using CreateStatus = std::function<ConnectionStatus::Ptr(Prx const&)>;
+
+    // the default lane shares the status of the client, the statuses of the other lane proxies
+    // are created by _createStatus
+    ProxyLanes(Prx _defaultProxy, ConnectionStatus::Ptr _defaultStatus,
+        CreateStatus _createStatus = [](Prx const& _proxy) {
+            return ConnectionStatus::create(_proxy);
+        })
+      : m_createStatus(std::move(_createStatus))
+    {
+        auto routes = std::make_unique<Routes>();
+        routes->ownLanes[(size_t)ProxyLane::Default] =
+            storeLane(Lane{std::move(_defaultProxy), std::move(_defaultStatus)});
+        resolveLanes(*routes);
+        publish(std::move(routes));
+    }
+
+    ProxyLanes(ProxyLanes const&) = delete;
+    ProxyLanes& operator=(ProxyLanes const&) = delete;
+
+    // the null proxy makes the lane fall back to the default lane again
+    void setLaneProxy(ProxyLane _lane, Prx _proxy)
+    {
+        std::lock_guard<std::mutex> lock(x_update);
+        auto routes = std::make_unique<Routes>(*currentRoutes());
+        if (_proxy.get())
+        {
+            auto status = m_createStatus(_proxy);
+            routes->ownLanes[(size_t)_lane] = storeLane(Lane{std::move(_proxy), std::move(status)});
+        }
+        else if (_lane != ProxyLane::Default)
+        {
+            routes->ownLanes[(size_t)_lane] = nullptr;
+        }
+        resolveLanes(*routes);
+        publish(std::move(routes));
+    }
+    void routeModule(int _moduleID, ProxyLane _lane)
+    {
+        std::lock_guard<std::mutex> lock(x_update);
+        auto routes = std::make_unique<Routes>(*currentRoutes());
+        routes->modules[_moduleID] = _lane;
+        publish(std::move(routes));
+    }
+    void routeMethod(std::string_view _method, ProxyLane _lane)
+    {
+        std::lock_guard<std::mutex> lock(x_update);
+        auto routes = std::make_unique<Routes>(*currentRoutes());
+        auto it = findMethod(*routes, _method);
+        if (it != routes->methods.end())
+        {
+            it->second = _lane;
+        }
+        else
+        {
+            routes->methods.emplace_back(std::string(_method), _lane);
+        }
+        publish(std::move(routes));
+    }
+
+    Lane const& lane(ProxyLane _lane = ProxyLane::Default) const
+    {
+        return *currentRoutes()->lanes[(size_t)_lane];
+    }
+    Lane const& laneOfModule(int _moduleID) const
+    {
+        auto const& routes = *currentRoutes();
+        auto it = routes.modules.find(_moduleID);
+        auto lane = it == routes.modules.end() ? ProxyLane::Default : it->second;
+        return *routes.lanes[(size_t)lane];
+    }
+    // the methods routed are a few, so they are scanned without hashing the name
+    Lane const& laneOfMethod(std::string_view _method) const
+    {
+        auto const& routes = *currentRoutes();
+        auto it = findMethod(routes, _method);
+        auto lane = it == routes.methods.end() ? ProxyLane::Default : it->second;
+        return *routes.lanes[(size_t)lane];
+    }
+
+    Prx const& proxy(ProxyLane _lane = ProxyLane::Default) const { return lane(_lane).proxy; }
+    Prx const& proxyOfModule(int _moduleID) const { return laneOfModule(_moduleID).proxy; }
+    Prx const& proxyOfMethod(std::string_view _method) const
+    {
+        return laneOfMethod(_method).proxy;
+    }
+
+private:
+    struct Routes
+    {
+        // null for the lanes without their own proxy
+        std::array<Lane const*, c_proxyLaneCount> ownLanes = {};
+        // the lanes used for routing, with the fallback resolved
+        std::array<Lane const*, c_proxyLaneCount> lanes = {};
+        std::unordered_map<int, ProxyLane> modules;
+        std::vector<std::pair<std::string, ProxyLane>> methods;
+    };
+
+    template <typename R>
+    static auto findMethod(R& _routes, std::string_view _method)
+    {
+        return std::find_if(_routes.methods.begin(), _routes.methods.end(),
+            [_method](auto const& _route) { return _route.first == _method; });
+    }
+
+    static void resolveLanes(Routes& _routes)
+    {
+        auto defaultLane = _routes.ownLanes[(size_t)ProxyLane::Default];
+        for (size_t i = 0; i < c_proxyLaneCount; ++i)
+        {
+            _routes.lanes[i] = _routes.ownLanes[i] ? _routes.ownLanes[i] : defaultLane;
+        }
+    }
+
+    Routes const* currentRoutes() const { return m_routes.load(std::memory_order_acquire); }
+
+    // called with x_update held, or in the constructor
+    Lane const* storeLane(Lane _lane)
+    {
+        m_lanes.emplace_back(std::make_unique<Lane const>(std::move(_lane)));
+        return m_lanes.back().get();
+    }
+    void publish(std::unique_ptr<Routes> _routes)
+    {
+        m_routes.store(_routes.get(), std::memory_order_release);
+        m_history.emplace_back(std::move(_routes));
+    }
+
+    CreateStatus m_createStatus;
+    std::atomic<Routes const*> m_routes = {nullptr};
+    // own the current and the replaced routes and lanes, which may still be used by the senders
+    std::vector<std::unique_ptr<Routes const>> m_history;
+    std::vector<std::unique_ptr<Lane const>> m_lanes;
+    std::mutex x_update;
+};
+}  // namespace bcostars
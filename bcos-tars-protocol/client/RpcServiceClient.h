@@ -21,6 +21,8 @@
 #pragma once
 #include "bcos-tars-protocol/Common.h"
 #include "bcos-tars-protocol/ErrorConverter.h"
+#include "bcos-tars-protocol/client/ClientMetrics.h"
+#include "bcos-tars-protocol/client/ConnectionStatus.h"
 #include "bcos-tars-protocol/protocol/TransactionSubmitResultImpl.h"
 #include "bcos-tars-protocol/tars/RpcService.h"
 #include <bcos-framework/interfaces/rpc/RPCInterface.h>
@@ -33,7 +35,9 @@ namespace bcostars
 class RpcServiceClient : public bcos::rpc::RPCInterface
 {
 public:
-    RpcServiceClient(bcostars::RpcServicePrx _proxy) : m_proxy(_proxy) {}
+    RpcServiceClient(bcostars::RpcServicePrx _proxy)
+      : m_proxy(_proxy), m_connection(ConnectionStatus::create(_proxy))
+    {}
     ~RpcServiceClient() override {}
 
     class Callback : public RpcServicePrxCallback
@@ -61,8 +65,11 @@ public:
         bcos::protocol::BlockNumber _blockNumber,
         std::function<void(bcos::Error::Ptr)> _callback) override
     {
-        auto ret = checkConnection(
-            c_moduleName, "asyncNotifyBlockNumber", m_proxy, [_callback](bcos::Error::Ptr _error) {
+        _callback = instrumentCallback(
+            BCOS_CLIENT_METRICS("RpcService", "asyncNotifyBlockNumber"), std::move(_callback));
+
+        auto ret = m_connection->check(
+            c_moduleName, "asyncNotifyBlockNumber", [_callback](bcos::Error::Ptr _error) {
                 if (_callback)
                 {
                     _callback(_error);
@@ -78,6 +85,9 @@ public:
     void asyncNotifyGroupInfo(bcos::group::GroupInfo::Ptr _groupInfo,
         std::function<void(bcos::Error::Ptr&&)> _callback) override
     {
+        _callback = instrumentCallback(
+            BCOS_CLIENT_METRICS("RpcService", "asyncNotifyGroupInfo"), std::move(_callback));
+
         class Callback : public bcostars::RpcServicePrxCallback
         {
         public:
@@ -95,8 +105,8 @@ public:
         private:
             std::function<void(bcos::Error::Ptr&&)> m_callback;
         };
-        auto ret = checkConnection(
-            c_moduleName, "asyncNotifyGroupInfo", m_proxy, [_callback](bcos::Error::Ptr _error) {
+        auto ret = m_connection->check(
+            c_moduleName, "asyncNotifyGroupInfo", [_callback](bcos::Error::Ptr _error) {
                 if (_callback)
                 {
                     _callback(std::move(_error));
@@ -114,6 +124,10 @@ public:
         std::function<void(bcos::Error::Ptr&& _error, bcos::bytesPointer _responseData)> _callback)
         override
     {
+        _callback = instrumentCallback(
+            BCOS_CLIENT_METRICS("RpcService", "asyncNotifyAMOPMessage"),
+            std::move(_callback), _data.size());
+
         class Callback : public bcostars::RpcServicePrxCallback
         {
         public:
@@ -136,8 +150,8 @@ public:
         private:
             std::function<void(bcos::Error::Ptr&&, bcos::bytesPointer)> m_callback;
         };
-        auto ret = checkConnection(
-            c_moduleName, "asyncNotifyAMOPMessage", m_proxy, [_callback](bcos::Error::Ptr _error) {
+        auto ret = m_connection->check(
+            c_moduleName, "asyncNotifyAMOPMessage", [_callback](bcos::Error::Ptr _error) {
                 if (_callback)
                 {
                     _callback(std::move(_error), nullptr);
@@ -155,6 +169,9 @@ public:
     void asyncNotifySubscribeTopic(
         std::function<void(bcos::Error::Ptr&& _error)> _callback) override
     {
+        _callback = instrumentCallback(
+            BCOS_CLIENT_METRICS("RpcService", "asyncNotifySubscribeTopic"), std::move(_callback));
+
         class Callback : public bcostars::RpcServicePrxCallback
         {
         public:
@@ -172,7 +189,7 @@ public:
         private:
             std::function<void(bcos::Error::Ptr&&)> m_callback;
         };
-        auto ret = checkConnection(c_moduleName, "asyncNotifySubscribeTopic", m_proxy,
+        auto ret = m_connection->check(c_moduleName, "asyncNotifySubscribeTopic",
             [_callback](bcos::Error::Ptr _error) {
                 if (_callback)
                 {
@@ -194,6 +211,7 @@ protected:
 
 private:
     bcostars::RpcServicePrx m_proxy;
+    ConnectionStatus::Ptr m_connection;
     std::string const c_moduleName = "RpcServiceClient";
     // AMOP timeout 40s
     const int c_amopTimeout = 40000;
@@ -19,6 +19,7 @@
  */
 #include "SchedulerServiceClient.h"
 #include "bcos-tars-protocol/ErrorConverter.h"
+#include "bcos-tars-protocol/client/ClientMetrics.h"
 #include "bcos-tars-protocol/protocol/TransactionImpl.h"
 #include "bcos-tars-protocol/protocol/TransactionReceiptImpl.h"
 
@@ -27,6 +28,9 @@ using namespace bcostars;
 void SchedulerServiceClient::call(bcos::protocol::Transaction::Ptr _tx,
     std::function<void(bcos::Error::Ptr&&, bcos::protocol::TransactionReceipt::Ptr&&)> _callback)
 {
+    _callback = instrumentCallback(
+        BCOS_CLIENT_METRICS("SchedulerService", "call"), std::move(_callback));
+
     class Callback : public SchedulerServicePrxCallback
     {
     public:
@@ -62,6 +66,9 @@ void SchedulerServiceClient::call(bcos::protocol::Transaction::Ptr _tx,
 void SchedulerServiceClient::getCode(
     std::string_view contract, std::function<void(bcos::Error::Ptr, bcos::bytes)> callback)
 {
+    callback = instrumentCallback(
+        BCOS_CLIENT_METRICS("SchedulerService", "getCode"), std::move(callback));
+
     class Callback : public SchedulerServicePrxCallback
     {
     public:
@@ -0,0 +1,61 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief immutable payload shared by the sends to multiple destinations
+ * @file SharedPayload.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <bcos-framework/libutilities/Common.h>
+#include <tarscpp/tup/Tars.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace bcostars
+{
+// holds the payload in the tars request form, the payload is copied at most once when created,
+// and the copies of the SharedPayload share the same payload, so the payload sent to several
+// destinations, services or groups is passed to tars without copying
+class SharedPayload
+{
+public:
+    SharedPayload() : m_data(std::make_shared<std::vector<tars::Char>>()) {}
+    explicit SharedPayload(bcos::bytesConstRef _payload)
+      : m_data(std::make_shared<std::vector<tars::Char>>(_payload.begin(), _payload.end()))
+    {
+        s_copiedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    explicit SharedPayload(std::vector<tars::Char>&& _payload)
+      : m_data(std::make_shared<std::vector<tars::Char>>(std::move(_payload)))
+    {}
+
+    size_t size() const { return m_data->size(); }
+    bool empty() const { return m_data->empty(); }
+    bcos::bytesConstRef ref() const
+    {
+        return bcos::bytesConstRef((bcos::byte const*)m_data->data(), m_data->size());
+    }
+    std::vector<tars::Char> const& tarsData() const { return *m_data; }
+
+    // the number of the payloads copied by SharedPayload in the process
+    static uint64_t copiedCount() { return s_copiedCount.load(std::memory_order_relaxed); }
+
+private:
+    std::shared_ptr<const std::vector<tars::Char>> m_data;
+    static inline std::atomic<uint64_t> s_copiedCount = {0};
+};
+}  // namespace bcostars
@@ -0,0 +1,226 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the single-producer/single-consumer ring over the shared memory
+ * @file ShmRing.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "ShmRing.h"
+#include <bcos-framework/libutilities/Error.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+
+using namespace bcostars;
+
+namespace
+{
+constexpr uint64_t c_shmRingMagic = 0x62636f7352696e67;  // "bcosRing"
+constexpr size_t c_cacheLineSize = 64;
+
+std::string shmName(std::string const& _name)
+{
+    return _name.empty() || _name[0] != '/' ? "/" + _name : _name;
+}
+}  // namespace
+
+// the producer owns head and the consumer owns tail, both count the bytes ever pushed or popped
+struct ShmRing::Header
+{
+    std::atomic<uint64_t> magic;
+    uint64_t capacity;
+    alignas(c_cacheLineSize) std::atomic<uint64_t> head;
+    alignas(c_cacheLineSize) std::atomic<uint64_t> tail;
+};
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+    "the ring positions are shared between processes and must be lock-free");
+
+ShmRing::Ptr ShmRing::create(std::string const& _name, size_t _capacity)
+{
+    size_t capacity = c_cacheLineSize;
+    while (capacity < _capacity)
+    {
+        capacity <<= 1;
+    }
+    auto name = shmName(_name);
+    auto fd = shm_open(name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600);
+    if (fd < 0)
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Create shared memory " + name + " failed!"));
+    }
+    auto mappedSize = sizeof(Header) + capacity;
+    if (ftruncate(fd, mappedSize) != 0)
+    {
+        close(fd);
+        shm_unlink(name.c_str());
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Resize shared memory " + name + " failed!"));
+    }
+    auto address = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED)
+    {
+        shm_unlink(name.c_str());
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Map shared memory " + name + " failed!"));
+    }
+    auto header = new (address) Header();
+    header->capacity = capacity;
+    header->head.store(0, std::memory_order_relaxed);
+    header->tail.store(0, std::memory_order_relaxed);
+    // the attachers check the magic, so it is published after the header is initialized
+    header->magic.store(c_shmRingMagic, std::memory_order_release);
+    return Ptr(new ShmRing(name, address, mappedSize, true));
+}
+
+ShmRing::Ptr ShmRing::open(std::string const& _name)
+{
+    auto name = shmName(_name);
+    auto fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0)
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Open shared memory " + name + " failed!"));
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(Header))
+    {
+        close(fd);
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Invalid shared memory " + name + "!"));
+    }
+    auto mappedSize = (size_t)status.st_size;
+    auto address = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED)
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Map shared memory " + name + " failed!"));
+    }
+    auto header = (Header*)address;
+    if (header->magic.load(std::memory_order_acquire) != c_shmRingMagic ||
+        header->capacity + sizeof(Header) != mappedSize)
+    {
+        munmap(address, mappedSize);
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Shared memory " + name + " is not a ring!"));
+    }
+    return Ptr(new ShmRing(name, address, mappedSize, false));
+}
+
+ShmRing::ShmRing(std::string _name, void* _address, size_t _mappedSize, bool _owner)
+  : m_name(std::move(_name)),
+    m_address(_address),
+    m_mappedSize(_mappedSize),
+    m_owner(_owner),
+    m_header((Header*)_address),
+    m_data((char*)_address + sizeof(Header)),
+    m_capacity(m_header->capacity)
+{}
+
+ShmRing::~ShmRing()
+{
+    munmap(m_address, m_mappedSize);
+    if (m_owner)
+    {
+        shm_unlink(m_name.c_str());
+    }
+}
+
+bool ShmRing::tryPush(bcos::bytesConstRef _payload)
+{
+    if (_payload.size() > maxPayloadSize())
+    {
+        return false;
+    }
+    auto head = m_header->head.load(std::memory_order_relaxed);
+    auto tail = m_header->tail.load(std::memory_order_acquire);
+    auto offset = head & (m_capacity - 1);
+    auto contiguous = m_capacity - offset;
+    auto size = frameSize(_payload.size());
+    auto required = contiguous < size ? contiguous + size : size;
+    if (m_capacity - (head - tail) < required)
+    {
+        return false;
+    }
+    if (contiguous < size)
+    {
+        // the zero length marker, the rest of the ring is skipped
+        std::memset(m_data + offset, 0, c_frameHeaderSize);
+        head += contiguous;
+        offset = 0;
+    }
+    uint32_t length = htonl((uint32_t)(c_frameHeaderSize + _payload.size()));
+    std::memcpy(m_data + offset, &length, c_frameHeaderSize);
+    std::memcpy(m_data + offset + c_frameHeaderSize, _payload.data(), _payload.size());
+    m_header->head.store(head + size, std::memory_order_release);
+    return true;
+}
+
+bool ShmRing::front(const char*& _payload, size_t& _payloadSize)
+{
+    if (m_corrupt)
+    {
+        return false;
+    }
+    auto tail = m_header->tail.load(std::memory_order_relaxed);
+    auto head = m_header->head.load(std::memory_order_acquire);
+    if (tail == head)
+    {
+        return false;
+    }
+    // the head and the lengths are written by the peer, and checked before reading the frame
+    size_t readable = head - tail;
+    if (readable > m_capacity)
+    {
+        m_corrupt = true;
+        return false;
+    }
+    auto offset = tail & (m_capacity - 1);
+    uint32_t length = 0;
+    std::memcpy(&length, m_data + offset, c_frameHeaderSize);
+    if (length == 0)
+    {
+        // the marker is always followed by a frame at the beginning of the ring
+        auto skipped = m_capacity - offset;
+        if (readable <= skipped)
+        {
+            m_corrupt = true;
+            return false;
+        }
+        tail += skipped;
+        readable -= skipped;
+        m_header->tail.store(tail, std::memory_order_release);
+        offset = 0;
+        std::memcpy(&length, m_data, c_frameHeaderSize);
+    }
+    length = ntohl(length);
+    if (length < c_frameHeaderSize || length - c_frameHeaderSize > maxPayloadSize() ||
+        frameSize(length - c_frameHeaderSize) > std::min(readable, m_capacity - offset))
+    {
+        m_corrupt = true;
+        return false;
+    }
+    _payload = m_data + offset + c_frameHeaderSize;
+    _payloadSize = length - c_frameHeaderSize;
+    return true;
+}
+
+void ShmRing::popFront(size_t _payloadSize)
+{
+    auto tail = m_header->tail.load(std::memory_order_relaxed);
+    m_header->tail.store(tail + frameSize(_payloadSize), std::memory_order_release);
+}
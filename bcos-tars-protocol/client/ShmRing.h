@@ -0,0 +1,98 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the single-producer/single-consumer ring over the shared memory
+ * @file ShmRing.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <bcos-framework/libutilities/Common.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace bcostars
+{
+// the frames are laid out as on the tars connections, a 4 bytes big-endian length including
+// itself followed by the encoded packet, and every frame starts at the 8 bytes boundary; the frame
+// not fitting in the rest of the ring is written from the beginning after a zero length marker;
+// the ring is lock-free for one producer and one consumer, which may be in different processes
+class ShmRing
+{
+public:
+    using Ptr = std::shared_ptr<ShmRing>;
+    static constexpr size_t c_frameHeaderSize = 4;
+    static constexpr size_t c_frameAlignment = 8;
+
+    // creates the shared memory segment of _capacity bytes, rounded up to the power of two, the
+    // segment is unlinked when the creator is destroyed
+    static Ptr create(std::string const& _name, size_t _capacity);
+    // attaches to the segment created by another process
+    static Ptr open(std::string const& _name);
+
+    ~ShmRing();
+    ShmRing(ShmRing const&) = delete;
+    ShmRing& operator=(ShmRing const&) = delete;
+
+    std::string const& name() const { return m_name; }
+    size_t capacity() const { return m_capacity; }
+    // the frames larger than half of the ring are rejected, so a frame always fits in an empty ring
+    size_t maxPayloadSize() const { return m_capacity / 2 - c_frameAlignment; }
+
+    // called by the producer only, returns false if the ring is full or the payload is too large
+    bool tryPush(bcos::bytesConstRef _payload);
+
+    // called by the consumer only, _consume(const char*, size_t) reads the payload in place
+    // before the frame is released to the producer; nothing is consumed once the ring is corrupt
+    template <typename F>
+    bool tryConsume(F&& _consume)
+    {
+        const char* payload = nullptr;
+        size_t payloadSize = 0;
+        if (!front(payload, payloadSize))
+        {
+            return false;
+        }
+        _consume(payload, payloadSize);
+        popFront(payloadSize);
+        return true;
+    }
+    // the consumer met a frame the producer can't have written, e.g. a length out of the ring
+    bool corrupt() const { return m_corrupt; }
+
+private:
+    struct Header;
+
+    ShmRing(std::string _name, void* _address, size_t _mappedSize, bool _owner);
+
+    bool front(const char*& _payload, size_t& _payloadSize);
+    void popFront(size_t _payloadSize);
+    static size_t frameSize(size_t _payloadSize)
+    {
+        return (c_frameHeaderSize + _payloadSize + c_frameAlignment - 1) & ~(c_frameAlignment - 1);
+    }
+
+    std::string m_name;
+    void* m_address;
+    size_t m_mappedSize;
+    bool m_owner;
+    Header* m_header;
+    char* m_data;
+    size_t m_capacity;
+    bool m_corrupt = false;
+};
+}  // namespace bcostars
@@ -0,0 +1,304 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the tars requests and responses over the shared memory rings of one host
+ * @file ShmTransport.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "ShmTransport.h"
+#include <vector>
+
+using namespace bcostars;
+
+namespace
+{
+constexpr size_t c_idleSpins = 2000;
+constexpr size_t c_idleYields = 200;
+constexpr auto c_idleSleep = std::chrono::microseconds(50);
+constexpr auto c_expireInterval = std::chrono::milliseconds(10);
+// how long the producer waits for the peer to drain the full ring
+constexpr auto c_fullRingWait = std::chrono::milliseconds(100);
+
+template <typename Packet>
+std::vector<tars::Char> encodePacket(Packet const& _packet)
+{
+    tars::TarsOutputStream<tars::BufferWriterVector> output;
+    _packet.writeTo(output);
+    std::vector<tars::Char> buffer;
+    output.swap(buffer);
+    return buffer;
+}
+
+template <typename Packet>
+bool decodePacket(const char* _data, size_t _size, Packet& _packet)
+{
+    try
+    {
+        tars::TarsInputStream<tars::BufferReader> input;
+        input.setBuffer(_data, _size);
+        _packet.readFrom(input);
+        return true;
+    }
+    catch (std::exception const&)
+    {
+        return false;
+    }
+}
+
+bool pushUntil(ShmRing& _ring, std::vector<tars::Char> const& _frame,
+    std::chrono::steady_clock::time_point _deadline)
+{
+    auto payload = bcos::bytesConstRef((bcos::byte const*)_frame.data(), _frame.size());
+    while (!_ring.tryPush(payload))
+    {
+        if (_frame.size() > _ring.maxPayloadSize() || std::chrono::steady_clock::now() > _deadline)
+        {
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+}  // namespace
+
+void ShmPoller::start(std::function<bool()> _pollOnce, std::function<void()> _onIdle)
+{
+    if (m_running.exchange(true))
+    {
+        return;
+    }
+    m_thread = std::thread([this, pollOnce = std::move(_pollOnce), onIdle = std::move(_onIdle)]() {
+        size_t idleRounds = 0;
+        while (m_running.load(std::memory_order_relaxed))
+        {
+            if (pollOnce())
+            {
+                idleRounds = 0;
+                continue;
+            }
+            if (onIdle)
+            {
+                onIdle();
+            }
+            ++idleRounds;
+            if (idleRounds < c_idleSpins)
+            {
+                continue;
+            }
+            if (idleRounds < c_idleSpins + c_idleYields)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            std::this_thread::sleep_for(c_idleSleep);
+        }
+    });
+}
+
+void ShmPoller::stop()
+{
+    if (!m_running.exchange(false))
+    {
+        return;
+    }
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+ShmTransportClient::ShmTransportClient(std::string const& _channel, std::string _servantName)
+  : m_requests(ShmRing::open(shmRequestRingName(_channel))),
+    m_responses(ShmRing::open(shmResponseRingName(_channel))),
+    m_servantName(std::move(_servantName))
+{
+    auto lastExpired = std::make_shared<std::chrono::steady_clock::time_point>();
+    m_poller.start([this]() { return pollResponses(); },
+        [this, lastExpired]() {
+            auto now = std::chrono::steady_clock::now();
+            if (now - *lastExpired > c_expireInterval)
+            {
+                *lastExpired = now;
+                expireRequests(false);
+            }
+        });
+}
+
+ShmTransportClient::~ShmTransportClient()
+{
+    m_poller.stop();
+    expireRequests(true);
+}
+
+void ShmTransportClient::invoke(std::string const& _funcName, std::vector<tars::Char>&& _params,
+    std::map<std::string, std::string> const& _context, ResponseCallback _callback)
+{
+    tars::RequestPacket request;
+    request.iVersion = tars::TARSVERSION;
+    request.cPacketType = _callback ? tars::TARSNORMAL : tars::TARSONEWAY;
+    request.iRequestId = ++m_requestID;
+    request.sServantName = m_servantName;
+    request.sFuncName = _funcName;
+    request.sBuffer = std::move(_params);
+    request.iTimeout = (tars::Int32)m_timeout.count();
+    request.context = _context;
+    auto frame = encodePacket(request);
+
+    auto deadline = std::chrono::steady_clock::now() + m_timeout;
+    if (_callback)
+    {
+        std::lock_guard<std::mutex> lock(x_pendingRequests);
+        m_pendingRequests[request.iRequestId] = PendingRequest{_callback, deadline};
+    }
+    bool pushed = false;
+    {
+        std::lock_guard<std::mutex> lock(x_requests);
+        auto pushDeadline = std::min(deadline, std::chrono::steady_clock::now() + c_fullRingWait);
+        pushed = pushUntil(*m_requests, frame, pushDeadline);
+    }
+    if (pushed || !_callback)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(x_pendingRequests);
+        if (m_pendingRequests.erase(request.iRequestId) == 0)
+        {
+            return;
+        }
+    }
+    _callback(tars::TARSSERVEROVERLOAD, tars::ResponsePacket());
+}
+
+bool ShmTransportClient::pollResponses()
+{
+    tars::ResponsePacket response;
+    bool decoded = false;
+    auto consumed = m_responses->tryConsume([&response, &decoded](const char* _data, size_t _size) {
+        decoded = decodePacket(_data, _size, response);
+    });
+    if (!consumed && m_responses->corrupt())
+    {
+        // no response can be read any more
+        expireRequests(true);
+    }
+    if (!consumed || !decoded)
+    {
+        return consumed;
+    }
+    ResponseCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(x_pendingRequests);
+        auto it = m_pendingRequests.find(response.iRequestId);
+        if (it == m_pendingRequests.end())
+        {
+            // expired already
+            return true;
+        }
+        callback = std::move(it->second.callback);
+        m_pendingRequests.erase(it);
+    }
+    auto ret = response.iRet;
+    callback(ret, std::move(response));
+    return true;
+}
+
+void ShmTransportClient::expireRequests(bool _all)
+{
+    std::vector<ResponseCallback> expired;
+    {
+        auto now = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(x_pendingRequests);
+        for (auto it = m_pendingRequests.begin(); it != m_pendingRequests.end();)
+        {
+            if (_all || it->second.deadline < now)
+            {
+                expired.emplace_back(std::move(it->second.callback));
+                it = m_pendingRequests.erase(it);
+                continue;
+            }
+            ++it;
+        }
+    }
+    for (auto& callback : expired)
+    {
+        callback(tars::TARSINVOKETIMEOUT, tars::ResponsePacket());
+    }
+}
+
+ShmTransportServer::ShmTransportServer(std::string const& _channel, size_t _capacity)
+  : m_requests(ShmRing::create(shmRequestRingName(_channel), _capacity)),
+    m_responses(ShmRing::create(shmResponseRingName(_channel), _capacity))
+{}
+
+void ShmTransportServer::start()
+{
+    m_poller.start([this]() { return pollRequests(); });
+}
+
+bool ShmTransportServer::pollRequests()
+{
+    tars::RequestPacket request;
+    bool decoded = false;
+    auto consumed = m_requests->tryConsume([&request, &decoded](const char* _data, size_t _size) {
+        decoded = decodePacket(_data, _size, request);
+    });
+    if (!consumed || !decoded)
+    {
+        return consumed;
+    }
+    auto it = m_handlers.find(request.sFuncName);
+    if (it == m_handlers.end())
+    {
+        if (request.cPacketType != tars::TARSONEWAY)
+        {
+            respond(request, tars::TARSSERVERNOFUNCERR, std::vector<tars::Char>());
+        }
+        return true;
+    }
+    if (request.cPacketType == tars::TARSONEWAY)
+    {
+        it->second(std::move(request), [](tars::Int32, std::vector<tars::Char>&&) {});
+        return true;
+    }
+    // only the fields the response refers to are kept by the responder
+    tars::RequestPacket header;
+    header.iVersion = request.iVersion;
+    header.iRequestId = request.iRequestId;
+    header.iMessageType = request.iMessageType;
+    it->second(std::move(request),
+        [this, header = std::move(header)](tars::Int32 _ret, std::vector<tars::Char>&& _result) {
+            respond(header, _ret, std::move(_result));
+        });
+    return true;
+}
+
+void ShmTransportServer::respond(
+    tars::RequestPacket const& _request, tars::Int32 _ret, std::vector<tars::Char>&& _result)
+{
+    tars::ResponsePacket response;
+    response.iVersion = _request.iVersion;
+    response.cPacketType = tars::TARSNORMAL;
+    response.iRequestId = _request.iRequestId;
+    response.iMessageType = _request.iMessageType;
+    response.iRet = _ret;
+    response.sBuffer = std::move(_result);
+    auto frame = encodePacket(response);
+
+    // the client expires the request if the response is dropped on the full ring
+    std::lock_guard<std::mutex> lock(x_responses);
+    pushUntil(*m_responses, frame, std::chrono::steady_clock::now() + c_fullRingWait);
+}
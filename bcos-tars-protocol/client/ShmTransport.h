@@ -0,0 +1,183 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the tars requests and responses over the shared memory rings of one host
+ * @file ShmTransport.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/client/ShmRing.h"
+#include <tarscpp/servant/Application.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace bcostars
+{
+constexpr size_t c_defaultShmRingCapacity = 16 * 1024 * 1024;
+
+// the parameters are encoded as the tars proxies do, the i-th parameter with the tag i + 1
+template <typename... Params>
+std::vector<tars::Char> encodeShmParams(Params const&... _params)
+{
+    tars::TarsOutputStream<tars::BufferWriterVector> output;
+    tars::Int32 tag = 1;
+    (output.write(_params, tag++), ...);
+    std::vector<tars::Char> buffer;
+    output.swap(buffer);
+    return buffer;
+}
+
+// the response is encoded as the tars servants do, the return value with the tag 0 and the i-th
+// out parameter with the tag _firstOutTag + i
+template <typename Ret, typename... Outs>
+std::vector<tars::Char> encodeShmResult(
+    Ret const& _ret, tars::Int32 _firstOutTag, Outs const&... _outs)
+{
+    tars::TarsOutputStream<tars::BufferWriterVector> output;
+    output.write(_ret, 0);
+    auto tag = _firstOutTag;
+    (output.write(_outs, tag++), ...);
+    std::vector<tars::Char> buffer;
+    output.swap(buffer);
+    return buffer;
+}
+
+// the response is decoded as the tars proxies do, the return value with the tag 0 and the i-th
+// out parameter with the tag _firstOutTag + i, returns the tars error code
+template <typename Ret, typename... Outs>
+tars::Int32 decodeShmResult(
+    tars::ResponsePacket const& _response, Ret& _ret, tars::Int32 _firstOutTag, Outs&... _outs)
+{
+    try
+    {
+        tars::TarsInputStream<tars::BufferReader> input;
+        input.setBuffer(_response.sBuffer.data(), _response.sBuffer.size());
+        input.read(_ret, 0, true);
+        auto tag = _firstOutTag;
+        (input.read(_outs, tag++, true), ...);
+        return tars::TARSSERVERSUCCESS;
+    }
+    catch (std::exception const&)
+    {
+        return tars::TARSCLIENTDECODEERR;
+    }
+}
+
+// the servant creates the rings of the channel, <channel>.req for the requests and <channel>.rsp
+// for the responses, and the client process attaches to them
+inline std::string shmRequestRingName(std::string const& _channel)
+{
+    return _channel + ".req";
+}
+inline std::string shmResponseRingName(std::string const& _channel)
+{
+    return _channel + ".rsp";
+}
+
+// the rings are polled by a dedicated thread, spinning for a while before yielding and sleeping,
+// so a request is picked up within microseconds while the peer is busy
+class ShmPoller
+{
+public:
+    void start(std::function<bool()> _pollOnce, std::function<void()> _onIdle = nullptr);
+    void stop();
+    ~ShmPoller() { stop(); }
+
+private:
+    std::atomic_bool m_running = {false};
+    std::thread m_thread;
+};
+
+// sends the tars requests through the request ring, and calls back with the tars responses,
+// _ret is the tars error code as the callback_xxx_exception of the proxies gets
+class ShmTransportClient
+{
+public:
+    using Ptr = std::shared_ptr<ShmTransportClient>;
+    using ResponseCallback = std::function<void(tars::Int32 _ret, tars::ResponsePacket&&)>;
+
+    ShmTransportClient(std::string const& _channel, std::string _servantName);
+    ~ShmTransportClient();
+
+    void setTimeout(std::chrono::milliseconds _timeout) { m_timeout = _timeout; }
+
+    // the one-way request if _callback is null
+    void invoke(std::string const& _funcName, std::vector<tars::Char>&& _params,
+        std::map<std::string, std::string> const& _context, ResponseCallback _callback);
+
+private:
+    struct PendingRequest
+    {
+        ResponseCallback callback;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    bool pollResponses();
+    void expireRequests(bool _all);
+
+    ShmRing::Ptr m_requests;
+    ShmRing::Ptr m_responses;
+    std::string m_servantName;
+    std::chrono::milliseconds m_timeout = std::chrono::milliseconds(30000);
+    std::atomic<tars::Int32> m_requestID = {0};
+    // the ring has a single producer, so the requesting threads take turns
+    std::mutex x_requests;
+    std::unordered_map<tars::Int32, PendingRequest> m_pendingRequests;
+    std::mutex x_pendingRequests;
+    ShmPoller m_poller;
+};
+
+// dispatches the requests of the channel to the handlers by the function name, the handlers are
+// called on the polling thread and may respond from any thread before the server is destroyed
+class ShmTransportServer
+{
+public:
+    using Ptr = std::shared_ptr<ShmTransportServer>;
+    using Responder = std::function<void(tars::Int32 _ret, std::vector<tars::Char>&& _result)>;
+    using Handler = std::function<void(tars::RequestPacket&&, Responder)>;
+
+    explicit ShmTransportServer(
+        std::string const& _channel, size_t _capacity = c_defaultShmRingCapacity);
+    ~ShmTransportServer() { stop(); }
+
+    // Note: the handlers must be registered before started
+    void registerHandler(std::string const& _funcName, Handler _handler)
+    {
+        m_handlers[_funcName] = std::move(_handler);
+    }
+
+    void start();
+    void stop() { m_poller.stop(); }
+
+private:
+    bool pollRequests();
+    void respond(tars::RequestPacket const& _request, tars::Int32 _ret,
+        std::vector<tars::Char>&& _result);
+
+    ShmRing::Ptr m_requests;
+    ShmRing::Ptr m_responses;
+    std::unordered_map<std::string, Handler> m_handlers;
+    std::mutex x_responses;
+    ShmPoller m_poller;
+};
+}  // namespace bcostars
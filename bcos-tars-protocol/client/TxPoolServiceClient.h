@@ -1,6 +1,9 @@
 #pragma once
 
 #include "bcos-tars-protocol/ErrorConverter.h"
+#include "bcos-tars-protocol/client/ClientMetrics.h"
+#include "bcos-tars-protocol/client/ClientTrace.h"
+#include "bcos-tars-protocol/client/ShmTransport.h"
 #include "bcos-tars-protocol/protocol/BlockImpl.h"
 #include "bcos-tars-protocol/protocol/TransactionImpl.h"
 #include "bcos-tars-protocol/protocol/TransactionSubmitResultImpl.h"
@@ -24,9 +27,22 @@ public:
     {}
     ~TxPoolServiceClient() override {}
 
+    // the consensus hot path, asyncVerifyBlock and asyncFillBlock, goes through the shared
+    // memory rings instead of the tars proxy once set, if the txpool runs on the same host
+    void setShmTransport(ShmTransportClient::Ptr _shmTransport)
+    {
+        std::atomic_store(&m_shmTransport, std::move(_shmTransport));
+    }
+
     void asyncSubmit(
         bcos::bytesPointer _tx, bcos::protocol::TxSubmitCallback _txSubmitCallback) override
     {
+        _txSubmitCallback = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "asyncSubmit"),
+            std::move(_txSubmitCallback), _tx->size());
+        auto span = ClientTracer::instance().startSpan("TxPoolService", "asyncSubmit");
+        _txSubmitCallback = span.wrap(std::move(_txSubmitCallback));
+
         class Callback : public bcostars::TxPoolServicePrxCallback
         {
         public:
@@ -58,7 +74,7 @@ public:
         // Note: tars_set_timeout unit is ms
         m_proxy->tars_set_timeout(600000)->async_asyncSubmit(
             new Callback(_txSubmitCallback, m_cryptoSuite),
-            std::vector<char>(_tx->begin(), _tx->end()));
+            std::vector<char>(_tx->begin(), _tx->end()), span.context());
     }
 
     void asyncSealTxs(size_t _txsLimit, bcos::txpool::TxsHashSetPtr _avoidTxs,
@@ -66,6 +82,11 @@ public:
             bcos::Error::Ptr, bcos::protocol::Block::Ptr, bcos::protocol::Block::Ptr)>
             _sealCallback) override
     {
+        _sealCallback = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "asyncSealTxs"), std::move(_sealCallback));
+        auto span = ClientTracer::instance().startSpan("TxPoolService", "asyncSealTxs");
+        _sealCallback = span.wrap(std::move(_sealCallback));
+
         class Callback : public bcostars::TxPoolServicePrxCallback
         {
         public:
@@ -112,13 +133,18 @@ public:
         }
 
         m_proxy->async_asyncSealTxs(
-            new Callback(m_blockFactory, _sealCallback), _txsLimit, tarsAvoidTxs);
+            new Callback(m_blockFactory, _sealCallback), _txsLimit, tarsAvoidTxs, span.context());
     }
 
     void asyncMarkTxs(bcos::crypto::HashListPtr _txsHash, bool _sealedFlag,
         bcos::protocol::BlockNumber _batchId, bcos::crypto::HashType const& _batchHash,
         std::function<void(bcos::Error::Ptr)> _onRecvResponse) override
     {
+        _onRecvResponse = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "asyncMarkTxs"), std::move(_onRecvResponse));
+        auto span = ClientTracer::instance().startSpan("TxPoolService", "asyncMarkTxs");
+        _onRecvResponse = span.wrap(std::move(_onRecvResponse));
+
         class Callback : public bcostars::TxPoolServicePrxCallback
         {
         public:
@@ -145,13 +171,19 @@ public:
         }
 
         m_proxy->async_asyncMarkTxs(new Callback(_onRecvResponse), txHashList, _sealedFlag,
-            _batchId, std::vector<char>(_batchHash.begin(), _batchHash.end()));
+            _batchId, std::vector<char>(_batchHash.begin(), _batchHash.end()), span.context());
     }
 
     void asyncVerifyBlock(bcos::crypto::PublicPtr _generatedNodeID,
         bcos::bytesConstRef const& _block,
         std::function<void(bcos::Error::Ptr, bool)> _onVerifyFinished) override
     {
+        _onVerifyFinished = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "asyncVerifyBlock"),
+            std::move(_onVerifyFinished), _block.size());
+        auto span = ClientTracer::instance().startSpan("TxPoolService", "asyncVerifyBlock");
+        _onVerifyFinished = span.wrap(std::move(_onVerifyFinished));
+
         class Callback : public bcostars::TxPoolServicePrxCallback
         {
         public:
@@ -172,15 +204,39 @@ public:
         };
 
         auto nodeID = _generatedNodeID->data();
+        if (auto shmTransport = std::atomic_load(&m_shmTransport))
+        {
+            shmTransport->invoke("asyncVerifyBlock",
+                encodeShmParams(std::vector<char>(nodeID.begin(), nodeID.end()),
+                    std::vector<char>(_block.begin(), _block.end())),
+                span.context(),
+                [callback = std::move(_onVerifyFinished)](
+                    tars::Int32 _ret, tars::ResponsePacket&& _response) {
+                    bcostars::Error ret;
+                    tars::Bool result = false;
+                    if (_ret == tars::TARSSERVERSUCCESS)
+                    {
+                        _ret = decodeShmResult(_response, ret, 3, result);
+                    }
+                    callback(_ret == tars::TARSSERVERSUCCESS ? toBcosError(ret) : toBcosError(_ret),
+                        result);
+                });
+            return;
+        }
         m_proxy->async_asyncVerifyBlock(new Callback(_onVerifyFinished),
             std::vector<char>(nodeID.begin(), nodeID.end()),
-            std::vector<char>(_block.begin(), _block.end()));
+            std::vector<char>(_block.begin(), _block.end()), span.context());
     }
 
     void asyncFillBlock(bcos::crypto::HashListPtr _txsHash,
         std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr)> _onBlockFilled)
         override
     {
+        _onBlockFilled = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "asyncFillBlock"), std::move(_onBlockFilled));
+        auto span = ClientTracer::instance().startSpan("TxPoolService", "asyncFillBlock");
+        _onBlockFilled = span.wrap(std::move(_onBlockFilled));
+
         class Callback : public bcostars::TxPoolServicePrxCallback
         {
         public:
@@ -220,13 +276,46 @@ public:
             hashList.emplace_back(hashData.begin(), hashData.end());
         }
 
-        m_proxy->async_asyncFillBlock(new Callback(_onBlockFilled, m_cryptoSuite), hashList);
+        if (auto shmTransport = std::atomic_load(&m_shmTransport))
+        {
+            shmTransport->invoke("asyncFillBlock", encodeShmParams(hashList), span.context(),
+                [callback = std::move(_onBlockFilled), cryptoSuite = m_cryptoSuite](
+                    tars::Int32 _ret, tars::ResponsePacket&& _response) {
+                    bcostars::Error ret;
+                    vector<bcostars::Transaction> filled;
+                    if (_ret == tars::TARSSERVERSUCCESS)
+                    {
+                        _ret = decodeShmResult(_response, ret, 2, filled);
+                    }
+                    if (_ret != tars::TARSSERVERSUCCESS)
+                    {
+                        callback(toBcosError(_ret), nullptr);
+                        return;
+                    }
+                    auto txs = std::make_shared<bcos::protocol::Transactions>();
+                    for (auto&& it : filled)
+                    {
+                        txs->push_back(std::make_shared<bcostars::protocol::TransactionImpl>(
+                            cryptoSuite, [m_tx = std::move(it)]() mutable { return &m_tx; }));
+                    }
+                    callback(toBcosError(ret), txs);
+                });
+            return;
+        }
+        m_proxy->async_asyncFillBlock(
+            new Callback(_onBlockFilled, m_cryptoSuite), hashList, span.context());
     }
 
     void asyncNotifyBlockResult(bcos::protocol::BlockNumber _blockNumber,
         bcos::protocol::TransactionSubmitResultsPtr _txsResult,
         std::function<void(bcos::Error::Ptr)> _onNotifyFinished) override
     {
+        _onNotifyFinished = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "asyncNotifyBlockResult"),
+            std::move(_onNotifyFinished));
+        auto span = ClientTracer::instance().startSpan("TxPoolService", "asyncNotifyBlockResult");
+        _onNotifyFinished = span.wrap(std::move(_onNotifyFinished));
+
         class Callback : public bcostars::TxPoolServicePrxCallback
         {
         public:
@@ -255,13 +344,17 @@ public:
         }
 
         m_proxy->async_asyncNotifyBlockResult(
-            new Callback(_onNotifyFinished), _blockNumber, resultList);
+            new Callback(_onNotifyFinished), _blockNumber, resultList, span.context());
     }
 
     void asyncNotifyTxsSyncMessage(bcos::Error::Ptr _error, std::string const& _id,
         bcos::crypto::NodeIDPtr _nodeID, bcos::bytesConstRef _data,
         std::function<void(bcos::Error::Ptr _error)> _onRecv) override
     {
+        _onRecv = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "asyncNotifyTxsSyncMessage"),
+            std::move(_onRecv), _data.size());
+
         class Callback : public bcostars::TxPoolServicePrxCallback
         {
         public:
@@ -292,6 +385,10 @@ public:
     void notifyConnectedNodes(bcos::crypto::NodeIDSet const& _connectedNodes,
         std::function<void(bcos::Error::Ptr)> _onRecvResponse) override
     {
+        _onRecvResponse = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "notifyConnectedNodes"),
+            std::move(_onRecvResponse));
+
         class Callback : public bcostars::TxPoolServicePrxCallback
         {
         public:
@@ -324,6 +421,10 @@ public:
     void notifyConsensusNodeList(bcos::consensus::ConsensusNodeList const& _consensusNodeList,
         std::function<void(bcos::Error::Ptr)> _onRecvResponse) override
     {
+        _onRecvResponse = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "notifyConsensusNodeList"),
+            std::move(_onRecvResponse));
+
         class Callback : public bcostars::TxPoolServicePrxCallback
         {
         public:
@@ -362,6 +463,10 @@ public:
     void notifyObserverNodeList(bcos::consensus::ConsensusNodeList const& _observerNodeList,
         std::function<void(bcos::Error::Ptr)> _onRecvResponse) override
     {
+        _onRecvResponse = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "notifyObserverNodeList"),
+            std::move(_onRecvResponse));
+
         class Callback : public bcostars::TxPoolServicePrxCallback
         {
         public:
@@ -399,6 +504,10 @@ public:
     void asyncGetPendingTransactionSize(
         std::function<void(bcos::Error::Ptr, size_t)> _onGetTxsSize) override
     {
+        _onGetTxsSize = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "asyncGetPendingTransactionSize"),
+            std::move(_onGetTxsSize));
+
         class Callback : public TxPoolServicePrxCallback
         {
         public:
@@ -425,6 +534,9 @@ public:
 
     void asyncResetTxPool(std::function<void(bcos::Error::Ptr)> _onRecv) override
     {
+        _onRecv = instrumentCallback(
+            BCOS_CLIENT_METRICS("TxPoolService", "asyncResetTxPool"), std::move(_onRecv));
+
         class Callback : public TxPoolServicePrxCallback
         {
         public:
@@ -456,6 +568,7 @@ private:
     bcostars::TxPoolServicePrx m_proxy;
     bcos::crypto::CryptoSuite::Ptr m_cryptoSuite;
     bcos::protocol::BlockFactory::Ptr m_blockFactory;
+    ShmTransportClient::Ptr m_shmTransport;
 };
 
 }  // namespace bcostars
\ No newline at end of file
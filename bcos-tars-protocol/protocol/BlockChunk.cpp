@@ -0,0 +1,174 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief split the encoded block into chunks and assemble the chunks into the block
+ * @file BlockChunk.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "BlockChunk.h"
+#include <bcos-framework/libutilities/Error.h>
+#include <algorithm>
+
+using namespace bcostars;
+using namespace bcostars::protocol;
+
+namespace
+{
+std::shared_ptr<bcos::bytes const> encodeBlock(bcos::protocol::Block::ConstPtr const& _block)
+{
+    auto encodedBlock = std::make_shared<bcos::bytes>();
+    _block->encode(*encodedBlock);
+    return encodedBlock;
+}
+}  // namespace
+
+BlockChunker::BlockChunker(
+    bcos::protocol::Block::ConstPtr _block, int64_t _transferID, size_t _chunkSize)
+  : BlockChunker(encodeBlock(_block), _transferID, _chunkSize)
+{}
+
+BlockChunker::BlockChunker(
+    std::shared_ptr<bcos::bytes const> _encodedBlock, int64_t _transferID, size_t _chunkSize)
+  : m_encodedBlock(std::move(_encodedBlock)),
+    m_transferID(_transferID),
+    m_chunkSize(std::max<size_t>(_chunkSize, 1))
+{}
+
+size_t BlockChunker::chunkCount() const
+{
+    return std::max<size_t>((m_encodedBlock->size() + m_chunkSize - 1) / m_chunkSize, 1);
+}
+
+bcostars::BlockChunk BlockChunker::chunk(size_t _index) const
+{
+    return chunkAt((int64_t)(_index * m_chunkSize), m_chunkSize);
+}
+
+bcostars::BlockChunk BlockChunker::chunkAt(int64_t _offset, size_t _chunkSize) const
+{
+    bcostars::BlockChunk chunk;
+    chunk.transferID = m_transferID;
+    chunk.totalSize = totalSize();
+    chunk.offset = std::clamp<int64_t>(_offset, 0, chunk.totalSize);
+    auto size = std::min<int64_t>(_chunkSize, chunk.totalSize - chunk.offset);
+    auto begin = m_encodedBlock->begin() + chunk.offset;
+    chunk.data.assign(begin, begin + size);
+    return chunk;
+}
+
+BlockChunkerCache::BlockChunkerCache(size_t _capacity) : m_capacity(std::max<size_t>(_capacity, 1))
+{}
+
+BlockChunker::Ptr BlockChunkerCache::find(int64_t _transferID)
+{
+    auto it = std::find_if(m_chunkers.begin(), m_chunkers.end(),
+        [_transferID](auto const& _chunker) { return _chunker->transferID() == _transferID; });
+    if (it == m_chunkers.end())
+    {
+        return nullptr;
+    }
+    m_chunkers.splice(m_chunkers.begin(), m_chunkers, it);
+    return m_chunkers.front();
+}
+
+BlockChunker::Ptr BlockChunkerCache::chunker(
+    int64_t _transferID, EncodeFunc const& _encode, size_t _chunkSize)
+{
+    {
+        std::lock_guard<std::mutex> lock(x_chunkers);
+        if (auto chunker = find(_transferID))
+        {
+            return chunker;
+        }
+    }
+    auto chunker = std::make_shared<BlockChunker>(_encode(), _transferID, _chunkSize);
+    std::lock_guard<std::mutex> lock(x_chunkers);
+    // encoded by a concurrent request meanwhile
+    if (auto cachedChunker = find(_transferID))
+    {
+        return cachedChunker;
+    }
+    m_chunkers.push_front(chunker);
+    if (m_chunkers.size() > m_capacity)
+    {
+        m_chunkers.pop_back();
+    }
+    return chunker;
+}
+
+BlockAssembler::BlockAssembler(int64_t _transferID, int64_t _totalSize)
+  : m_transferID(_transferID), m_buffer(std::max<int64_t>(_totalSize, 0))
+{}
+
+BlockAssembler::Ptr BlockAssembler::create(
+    int64_t _transferID, int64_t _totalSize, int64_t _maxTotalSize)
+{
+    if (_totalSize <= 0 || _totalSize > _maxTotalSize)
+    {
+        return nullptr;
+    }
+    try
+    {
+        return std::make_shared<BlockAssembler>(_transferID, _totalSize);
+    }
+    catch (std::bad_alloc const&)
+    {
+        return nullptr;
+    }
+}
+
+bool BlockAssembler::append(bcostars::BlockChunk const& _chunk)
+{
+    auto size = (int64_t)_chunk.data.size();
+    if (_chunk.transferID != m_transferID || _chunk.totalSize != totalSize() ||
+        _chunk.offset < 0 || _chunk.offset + size > totalSize())
+    {
+        return false;
+    }
+    if (size == 0)
+    {
+        return true;
+    }
+    // the received chunk starting after the offset must start after the end of this chunk, and
+    // the one starting before the offset must end before it
+    auto next = m_receivedChunks.lower_bound(_chunk.offset);
+    if (next != m_receivedChunks.end() && next->first < _chunk.offset + size)
+    {
+        return false;
+    }
+    if (next != m_receivedChunks.begin())
+    {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second > _chunk.offset)
+        {
+            return false;
+        }
+    }
+    std::copy(_chunk.data.begin(), _chunk.data.end(), m_buffer.begin() + _chunk.offset);
+    m_receivedChunks.emplace_hint(next, _chunk.offset, size);
+    m_receivedSize += size;
+    return true;
+}
+
+bcos::protocol::Block::Ptr BlockAssembler::decode(
+    bcos::protocol::BlockFactory& _blockFactory, bool _calculateHash, bool _checkSig) const
+{
+    if (!complete())
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Incomplete block transfer!"));
+    }
+    return _blockFactory.createBlock(bcos::ref(m_buffer), _calculateHash, _checkSig);
+}
@@ -0,0 +1,127 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief split the encoded block into chunks and assemble the chunks into the block
+ * @file BlockChunk.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/tars/Block.h"
+#include <bcos-framework/interfaces/protocol/BlockFactory.h>
+#include <bcos-framework/libutilities/Common.h>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace bcostars
+{
+namespace protocol
+{
+// 1MB per chunk by default
+constexpr size_t c_defaultBlockChunkSize = 1024 * 1024;
+// the largest encoded block the receiver preallocates a buffer for by default
+constexpr int64_t c_defaultMaxBlockSize = 256 * 1024 * 1024;
+
+// holds the encoded block and slices it into chunks of at most _chunkSize bytes, only one chunk
+// is copied at a time
+class BlockChunker
+{
+public:
+    using Ptr = std::shared_ptr<BlockChunker>;
+    BlockChunker(bcos::protocol::Block::ConstPtr _block, int64_t _transferID,
+        size_t _chunkSize = c_defaultBlockChunkSize);
+    BlockChunker(std::shared_ptr<bcos::bytes const> _encodedBlock, int64_t _transferID,
+        size_t _chunkSize = c_defaultBlockChunkSize);
+
+    int64_t transferID() const { return m_transferID; }
+    int64_t totalSize() const { return (int64_t)m_encodedBlock->size(); }
+    size_t chunkSize() const { return m_chunkSize; }
+    // an empty block is still sent in one empty chunk
+    size_t chunkCount() const;
+
+    bcostars::BlockChunk chunk(size_t _index) const;
+    // the chunk starting from _offset, with at most _chunkSize bytes
+    bcostars::BlockChunk chunkAt(int64_t _offset, size_t _chunkSize) const;
+
+private:
+    std::shared_ptr<bcos::bytes const> m_encodedBlock;
+    int64_t m_transferID;
+    size_t m_chunkSize;
+};
+
+// keeps the chunkers of the latest transfers, so the servant encodes a block once per transfer
+// instead of once per requested chunk; the transfer ID must identify the encoded block, e.g. the
+// block number when the block is always served with the same flag, and at most _capacity encoded
+// blocks are held
+class BlockChunkerCache
+{
+public:
+    using EncodeFunc = std::function<std::shared_ptr<bcos::bytes const>()>;
+    static constexpr size_t c_defaultCapacity = 4;
+
+    explicit BlockChunkerCache(size_t _capacity = c_defaultCapacity);
+
+    // the chunker of the transfer, the block is encoded by _encode if it is not cached
+    // Note: _encode is called without the lock, so the same block may be encoded by concurrent
+    // requests of a new transfer
+    BlockChunker::Ptr chunker(int64_t _transferID, EncodeFunc const& _encode,
+        size_t _chunkSize = c_defaultBlockChunkSize);
+
+private:
+    // Note: must be called with x_chunkers locked
+    BlockChunker::Ptr find(int64_t _transferID);
+
+    size_t m_capacity;
+    std::mutex x_chunkers;
+    // the most recently used first
+    std::list<BlockChunker::Ptr> m_chunkers;
+};
+
+// writes the chunks into a buffer preallocated with the total size, the chunks can arrive in
+// any order; the chunks of other transfers, out of range or overlapping with the received ones
+// are rejected
+class BlockAssembler
+{
+public:
+    using Ptr = std::shared_ptr<BlockAssembler>;
+    BlockAssembler(int64_t _transferID, int64_t _totalSize);
+    // the total size is taken from the first received chunk, which must not be trusted: nullptr if
+    // it is not in (0, _maxTotalSize] or the buffer can't be allocated
+    static Ptr create(
+        int64_t _transferID, int64_t _totalSize, int64_t _maxTotalSize = c_defaultMaxBlockSize);
+
+    int64_t transferID() const { return m_transferID; }
+    int64_t totalSize() const { return (int64_t)m_buffer.size(); }
+    int64_t receivedSize() const { return m_receivedSize; }
+    bool complete() const { return m_receivedSize == totalSize(); }
+
+    bool append(bcostars::BlockChunk const& _chunk);
+    // Note: the block can only be decoded once the transfer is complete
+    bcos::protocol::Block::Ptr decode(bcos::protocol::BlockFactory& _blockFactory,
+        bool _calculateHash = true, bool _checkSig = true) const;
+
+private:
+    int64_t m_transferID;
+    bcos::bytes m_buffer;
+    // offset => size of the received chunks
+    std::map<int64_t, int64_t> m_receivedChunks;
+    int64_t m_receivedSize = 0;
+};
+}  // namespace protocol
+}  // namespace bcostars
@@ -20,6 +20,7 @@
  */
 #pragma once
 #include "BlockImpl.h"
+#include "bcos-tars-protocol/AllocationTracker.h"
 #include "bcos-tars-protocol/tars/Block.h"
 #include <bcos-framework/interfaces/protocol/BlockFactory.h>
 #include <bcos-framework/interfaces/protocol/BlockHeaderFactory.h>
@@ -57,12 +58,22 @@ public:
     bcos::protocol::Block::Ptr createBlock(
         bcos::bytesConstRef _data, bool _calculateHash = true, bool _checkSig = true) override
     {
+        BCOS_TARS_ALLOC_SCOPE("BlockFactoryImpl::createBlock");
         auto block = std::make_shared<BlockImpl>(m_transactionFactory, m_receiptFactory);
         block->decode(_data, _calculateHash, _checkSig);
 
         return block;
     }
 
+    // the header is decoded at once and the lists at their first use, see BlockImpl::decodeLazily
+    std::shared_ptr<BlockImpl> createBlockLazily(std::shared_ptr<bcos::bytes const> _encodedBlock)
+    {
+        BCOS_TARS_ALLOC_SCOPE("BlockFactoryImpl::createBlockLazily");
+        auto block = std::make_shared<BlockImpl>(m_transactionFactory, m_receiptFactory);
+        block->decodeLazily(std::move(_encodedBlock));
+        return block;
+    }
+
     bcos::crypto::CryptoSuite::Ptr cryptoSuite() override { return m_cryptoSuite; }
     bcos::protocol::BlockHeaderFactory::Ptr blockHeaderFactory() override
     {
@@ -19,6 +19,10 @@
  * @date 2021-04-20
  */
 #include "BlockHeaderImpl.h"
+#include "DecimalCodec.h"
+#include "HashField.h"
+#include "WireCodec.h"
+#include "bcos-tars-protocol/AllocationTracker.h"
 #include "libutilities/Common.h"
 #include <tup/Tars.h>
 
@@ -26,14 +30,21 @@ using namespace bcostars;
 using namespace bcostars::protocol;
 void BlockHeaderImpl::decode(bcos::bytesConstRef _data)
 {
-    tars::TarsInputStream<tars::BufferReader> input;
-    input.setBuffer((const char*)_data.data(), _data.size());
-
-    m_inner()->readFrom(input);
+    BCOS_TARS_ALLOC_SCOPE("BlockHeaderImpl::decode");
+    bcos::bytesConstRef hashData;
+    readBlockHeaderWithHashData(_data, *m_inner(), hashData);
+    m_parentInfo.reset();
+    dropHashData();
+    // kept only if the hash is to be calculated, instead of writing the data again
+    if (!hasHash(m_inner()->dataHash))
+    {
+        m_dataBuffer.assign(hashData.begin(), hashData.end());
+    }
 }
 
 void BlockHeaderImpl::encode(bcos::bytes& _encodeData) const
 {
+    BCOS_TARS_ALLOC_SCOPE("BlockHeaderImpl::encode");
     tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
 
     m_inner()->writeTo(output);
@@ -42,98 +53,99 @@ void BlockHeaderImpl::encode(bcos::bytes& _encodeData) const
 
 bcos::crypto::HashType BlockHeaderImpl::hash() const
 {
-    if (m_inner()->dataHash.empty())
+    if (!hasHash(m_inner()->dataHash))
     {
-        tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
-        m_inner()->data.writeTo(output);
-
-        auto hash = m_cryptoSuite->hash(output.getByteBuffer());
-
-        m_inner()->dataHash.assign(hash.begin(), hash.end());
+        auto hashData = m_hashDataSource ? m_hashDataSource() : bcos::bytesConstRef();
+        if (hashData.empty())
+        {
+            if (m_dataBuffer.empty())
+            {
+                tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
+                m_inner()->data.writeTo(output);
+                output.getByteBuffer().swap(m_dataBuffer);
+            }
+            hashData = bcos::ref(m_dataBuffer);
+        }
+        auto hash = m_cryptoSuite->hash(hashData);
+        assignHash(m_inner()->dataHash, hash);
+        dropHashData();
+        bcos::bytes().swap(m_dataBuffer);
     }
 
-    return *(reinterpret_cast<const bcos::crypto::HashType*>(m_inner()->dataHash.data()));
+    return hashFromField(m_inner()->dataHash);
 }
 
 void BlockHeaderImpl::clear()
 {
     m_inner()->resetDefautlt();
-    m_parentInfo.clear();
+    m_parentInfo.reset();
+    dropHashData();
 }
 
 gsl::span<const bcos::protocol::ParentInfo> BlockHeaderImpl::parentInfo() const
 {
-    if (m_parentInfo.empty())
-    {
+    auto const& parentInfoList = m_parentInfo.get([this]() {
+        std::vector<bcos::protocol::ParentInfo> parentInfoList;
+        parentInfoList.reserve(m_inner()->data.parentInfo.size());
         for (auto const& it : m_inner()->data.parentInfo)
         {
             bcos::protocol::ParentInfo parentInfo;
             parentInfo.blockNumber = it.blockNumber;
-            parentInfo.blockHash =
-                *(reinterpret_cast<const bcos::crypto::HashType*>(it.blockHash.data()));
-            m_parentInfo.emplace_back(parentInfo);
+            parentInfo.blockHash = hashFromField(it.blockHash);
+            parentInfoList.emplace_back(parentInfo);
         }
-    }
+        return parentInfoList;
+    });
 
-    return gsl::span(m_parentInfo.data(), m_parentInfo.size());
+    return gsl::span(parentInfoList.data(), parentInfoList.size());
 }
 
 bcos::crypto::HashType BlockHeaderImpl::txsRoot() const
 {
-    if (!m_inner()->data.txsRoot.empty())
-    {
-        return *(reinterpret_cast<const bcos::crypto::HashType*>(m_inner()->data.txsRoot.data()));
-    }
-    return {};
+    return hashFromField(m_inner()->data.txsRoot);
 }
 
 bcos::crypto::HashType BlockHeaderImpl::stateRoot() const
 {
-    if (!m_inner()->data.stateRoot.empty())
-    {
-        return *(reinterpret_cast<const bcos::crypto::HashType*>(m_inner()->data.stateRoot.data()));
-    }
-    return {};
+    return hashFromField(m_inner()->data.stateRoot);
 }
 
 bcos::crypto::HashType BlockHeaderImpl::receiptsRoot() const
 {
-    if (!m_inner()->data.receiptRoot.empty())
-    {
-        return *(
-            reinterpret_cast<const bcos::crypto::HashType*>(m_inner()->data.receiptRoot.data()));
-    }
-    return {};
+    return hashFromField(m_inner()->data.receiptRoot);
 }
 
 bcos::u256 BlockHeaderImpl::gasUsed() const
 {
     if (!m_inner()->data.gasUsed.empty())
     {
-        return boost::lexical_cast<bcos::u256>(m_inner()->data.gasUsed);
+        return parseDecimalU256(m_inner()->data.gasUsed);
     }
     return {};
 }
 
 void BlockHeaderImpl::setParentInfo(gsl::span<const bcos::protocol::ParentInfo> const& _parentInfo)
 {
-    m_parentInfo.clear();
-    m_inner()->data.parentInfo.clear();
+    m_parentInfo.reset();
+    auto& parentInfoList = mutableData().parentInfo;
+    parentInfoList.clear();
+    parentInfoList.reserve(_parentInfo.size());
     for (auto& it : _parentInfo)
     {
         ParentInfo parentInfo;
         parentInfo.blockNumber = it.blockNumber;
-        parentInfo.blockHash.assign(it.blockHash.begin(), it.blockHash.end());
-        m_inner()->data.parentInfo.emplace_back(parentInfo);
+        assignHash(parentInfo.blockHash, it.blockHash);
+        parentInfoList.emplace_back(std::move(parentInfo));
     }
 }
 
 void BlockHeaderImpl::setSealerList(gsl::span<const bcos::bytes> const& _sealerList)
 {
-    m_inner()->data.sealerList.clear();
+    auto& sealerList = mutableData().sealerList;
+    sealerList.clear();
     for (auto const& it : _sealerList)
     {
-        m_inner()->data.sealerList.push_back(std::vector<char>(it.begin(), it.end()));
+        sealerList.push_back(std::vector<char>(it.begin(), it.end()));
     }
 }
 
@@ -20,6 +20,9 @@
  */
 
 #pragma once
+#include "DecimalCodec.h"
+#include "HashField.h"
+#include "LazyValue.h"
 #include "bcos-tars-protocol/Common.h"
 #include "bcos-tars-protocol/tars/Block.h"
 #include <bcos-framework/interfaces/crypto/CommonType.h>
@@ -85,7 +88,7 @@ public:
             m_inner()->data.consensusWeights.size());
     }
 
-    void setVersion(int32_t _version) override { m_inner()->data.version = _version; }
+    void setVersion(int32_t _version) override { mutableData().version = _version; }
 
     void setParentInfo(gsl::span<const bcos::protocol::ParentInfo> const& _parentInfo) override;
 
@@ -96,26 +99,26 @@ public:
 
     void setTxsRoot(bcos::crypto::HashType _txsRoot) override
     {
-        m_inner()->data.txsRoot.assign(_txsRoot.begin(), _txsRoot.end());
+        assignHash(mutableData().txsRoot, _txsRoot);
     }
     void setReceiptsRoot(bcos::crypto::HashType _receiptsRoot) override
     {
-        m_inner()->data.receiptRoot.assign(_receiptsRoot.begin(), _receiptsRoot.end());
+        assignHash(mutableData().receiptRoot, _receiptsRoot);
     }
     void setStateRoot(bcos::crypto::HashType _stateRoot) override
     {
-        m_inner()->data.stateRoot.assign(_stateRoot.begin(), _stateRoot.end());
+        assignHash(mutableData().stateRoot, _stateRoot);
     }
     void setNumber(bcos::protocol::BlockNumber _blockNumber) override
     {
-        m_inner()->data.blockNumber = _blockNumber;
+        mutableData().blockNumber = _blockNumber;
     }
     void setGasUsed(bcos::u256 _gasUsed) override
     {
-        m_inner()->data.gasUsed = boost::lexical_cast<std::string>(_gasUsed);
+        mutableData().gasUsed = formatDecimalU256(_gasUsed);
     }
-    void setTimestamp(int64_t _timestamp) override { m_inner()->data.timestamp = _timestamp; }
-    void setSealer(int64_t _sealerId) override { m_inner()->data.sealer = _sealerId; }
+    void setTimestamp(int64_t _timestamp) override { mutableData().timestamp = _timestamp; }
+    void setSealer(int64_t _sealerId) override { mutableData().sealer = _sealerId; }
     void setSealerList(gsl::span<const bcos::bytes> const& _sealerList) override;
     void setSealerList(std::vector<bcos::bytes>&& _sealerList) override
     {
@@ -124,7 +127,7 @@ public:
 
     void setConsensusWeights(gsl::span<const uint64_t> const& _weightList) override
     {
-        m_inner()->data.consensusWeights.assign(_weightList.begin(), _weightList.end());
+        mutableData().consensusWeights.assign(_weightList.begin(), _weightList.end());
     }
 
     void setConsensusWeights(std::vector<uint64_t>&& _weightList) override
@@ -134,11 +137,11 @@ public:
 
     void setExtraData(bcos::bytes const& _extraData) override
     {
-        m_inner()->data.extraData.assign(_extraData.begin(), _extraData.end());
+        mutableData().extraData.assign(_extraData.begin(), _extraData.end());
     }
     void setExtraData(bcos::bytes&& _extraData) override
     {
-        m_inner()->data.extraData.assign(_extraData.begin(), _extraData.end());
+        mutableData().extraData.assign(_extraData.begin(), _extraData.end());
     }
     void setSignatureList(
         gsl::span<const bcos::protocol::Signature> const& _signatureList) override;
@@ -150,12 +153,46 @@ public:
 
     const bcostars::BlockHeader& inner() const { return *m_inner(); }
 
-    void setInner(const bcostars::BlockHeader& blockHeader) { *m_inner() = blockHeader; }
-    void setInner(bcostars::BlockHeader&& blockHeader) { *m_inner() = std::move(blockHeader); }
+    // hashes the encoded data as decoded within the block, which _source returns when hashing,
+    // instead of writing the data again; the block shares the header with the other objects it
+    // hands out, so it returns nothing once the header may have been modified through them
+    void setHashDataSource(std::function<bcos::bytesConstRef()> _source)
+    {
+        m_hashDataSource = std::move(_source);
+    }
+
+    void setInner(const bcostars::BlockHeader& blockHeader)
+    {
+        *m_inner() = blockHeader;
+        m_parentInfo.reset();
+        dropHashData();
+    }
+    void setInner(bcostars::BlockHeader&& blockHeader)
+    {
+        *m_inner() = std::move(blockHeader);
+        m_parentInfo.reset();
+        dropHashData();
+    }
 
 private:
+    // the data to be modified, whose received encoding is no longer the preimage of the hash
+    bcostars::BlockHeaderData& mutableData()
+    {
+        dropHashData();
+        return m_inner()->data;
+    }
+    void dropHashData() const
+    {
+        m_dataBuffer.clear();
+        m_hashDataSource = nullptr;
+    }
+
     std::function<bcostars::BlockHeader*()> m_inner;
-    mutable std::vector<bcos::protocol::ParentInfo> m_parentInfo;
+    LazyValue<std::vector<bcos::protocol::ParentInfo>> m_parentInfo;
+    // the received encoding of the data until the hash is calculated, copied by decode, or in the
+    // block m_hashDataSource is of
+    mutable bcos::bytes m_dataBuffer;
+    mutable std::function<bcos::bytesConstRef()> m_hashDataSource;
 };
 }  // namespace protocol
 }  // namespace bcostars
\ No newline at end of file
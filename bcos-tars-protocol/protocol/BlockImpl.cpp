@@ -20,19 +20,68 @@
  */
 
 #include "BlockImpl.h"
+#include "DecimalCodec.h"
+#include "NonceCodec.h"
+#include "bcos-tars-protocol/AllocationTracker.h"
+#include <bcos-framework/libutilities/Error.h>
 using namespace bcostars;
 using namespace bcostars::protocol;
 
+namespace
+{
+void encodeNonceList(bcostars::Block& _block, bcos::protocol::NonceList const& _nonceList)
+{
+    _block.nonceList.clear();
+    _block.nonceListBytes.clear();
+    if (_block.blockHeader.data.version >= c_binaryNonceVersion)
+    {
+        _block.nonceListBytes.resize(_nonceList.size() * c_binaryNonceSize);
+        auto out = _block.nonceListBytes.data();
+        for (auto const& it : _nonceList)
+        {
+            encodeBinaryNonce(it, out);
+            out += c_binaryNonceSize;
+        }
+        return;
+    }
+    _block.nonceList.reserve(_nonceList.size());
+    for (auto const& it : _nonceList)
+    {
+        _block.nonceList.emplace_back(formatDecimalU256(it));
+    }
+}
+}  // namespace
+
 void BlockImpl::decode(bcos::bytesConstRef _data, bool, bool)
 {
+    BCOS_TARS_ALLOC_SCOPE("BlockImpl::decode");
     tars::TarsInputStream<tars::BufferReader> input;
     input.setBuffer((const char*)_data.data(), _data.size());
 
     m_inner->readFrom(input);
+    resetLazy();
+    m_nonceList.reset();
+}
+
+void BlockImpl::decodeLazily(std::shared_ptr<bcos::bytes const> _encodedBlock)
+{
+    BCOS_TARS_ALLOC_SCOPE("BlockImpl::decodeLazily");
+    m_nonceList.reset();
+    resetLazy();
+    m_lazy = LazyBlock::open(_encodedBlock, m_inner);
+    if (!m_lazy)
+    {
+        decode(bcos::ref(*_encodedBlock), false, false);
+    }
 }
 
 void BlockImpl::encode(bcos::bytes& _encodeData) const
 {
+    BCOS_TARS_ALLOC_SCOPE("BlockImpl::encode");
+    if (m_lazy)
+    {
+        m_lazy->materialize();
+    }
     tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
 
     m_inner->writeTo(output);
@@ -41,6 +90,9 @@ void BlockImpl::encode(bcos::bytes& _encodeData) const
 
 bcos::protocol::BlockHeader::Ptr BlockImpl::blockHeader()
 {
+    // the header may be modified through it, so the headers got before or after it no longer hash
+    // the received data
+    dropHeaderHashData();
     return std::make_shared<bcostars::protocol::BlockHeaderImpl>(
         m_transactionFactory->cryptoSuite(),
         [inner = this->m_inner]() mutable { return &inner->blockHeader; });
@@ -48,36 +100,102 @@ bcos::protocol::BlockHeader::Ptr BlockImpl::blockHeader()
 
 bcos::protocol::BlockHeader::ConstPtr BlockImpl::blockHeaderConst() const
 {
-    return std::make_shared<const bcostars::protocol::BlockHeaderImpl>(
+    auto blockHeader = std::make_shared<bcostars::protocol::BlockHeaderImpl>(
         m_transactionFactory->cryptoSuite(),
         [inner = this->m_inner]() { return &inner->blockHeader; });
+    if (m_lazy)
+    {
+        // looked up when hashing, as the header may be modified through blockHeader() meanwhile
+        blockHeader->setHashDataSource([lazy = m_lazy]() { return lazy->headerHashData(); });
+    }
+    return blockHeader;
 }
 
 bcos::protocol::Transaction::ConstPtr BlockImpl::transaction(size_t _index) const
 {
-    return std::make_shared<const bcostars::protocol::TransactionImpl>(
+    std::shared_ptr<bcostars::protocol::TransactionImpl> transaction;
+    if (lazy())
+    {
+        // the element is never modified, even after it is copied into the list of the block
+        transaction = std::make_shared<bcostars::protocol::TransactionImpl>(
+            m_transactionFactory->cryptoSuite(),
+            [element = m_lazy->transaction(_index)]() { return element.get(); });
+        transaction->setHashData(m_lazy->encodedBlock(), m_lazy->transactionHashData(_index));
+        return transaction;
+    }
+    transaction = std::make_shared<bcostars::protocol::TransactionImpl>(
         m_transactionFactory->cryptoSuite(),
         [inner = m_inner, _index]() { return &(inner->transactions[_index]); });
+    if (m_lazy)
+    {
+        // looked up when hashing, as the list may be modified meanwhile
+        transaction->setHashDataSource(
+            [lazy = m_lazy, _index]() { return lazy->transactionHashData(_index); });
+    }
+    return transaction;
 }
 
 bcos::protocol::TransactionReceipt::ConstPtr BlockImpl::receipt(size_t _index) const
 {
-    return std::make_shared<const bcostars::protocol::TransactionReceiptImpl>(
+    std::shared_ptr<bcostars::protocol::TransactionReceiptImpl> receipt;
+    if (lazy())
+    {
+        receipt = std::make_shared<bcostars::protocol::TransactionReceiptImpl>(
+            m_transactionFactory->cryptoSuite(),
+            [element = m_lazy->receipt(_index)]() { return element.get(); });
+        receipt->setHashData(m_lazy->encodedBlock(), m_lazy->receiptHashData(_index));
+        return receipt;
+    }
+    receipt = std::make_shared<bcostars::protocol::TransactionReceiptImpl>(
         m_transactionFactory->cryptoSuite(),
         [inner = m_inner, _index]() { return &(inner->receipts[_index]); });
+    if (m_lazy)
+    {
+        receipt->setHashDataSource(
+            [lazy = m_lazy, _index]() { return lazy->receiptHashData(_index); });
+    }
+    return receipt;
+}
+
+void BlockImpl::setVersion(int32_t _version)
+{
+    auto oldVersion = version();
+    dropHeaderHashData();
+    m_inner->blockHeader.data.version = _version;
+    reencodeNonceList(oldVersion);
 }
 
 void BlockImpl::setBlockHeader(bcos::protocol::BlockHeader::Ptr _blockHeader)
 {
     if (_blockHeader)
     {
+        auto oldVersion = version();
+        dropHeaderHashData();
         m_inner->blockHeader =
             std::dynamic_pointer_cast<bcostars::protocol::BlockHeaderImpl>(_blockHeader)->inner();
+        reencodeNonceList(oldVersion);
+    }
+}
+
+void BlockImpl::reencodeNonceList(int32_t _oldVersion)
+{
+    if ((_oldVersion >= c_binaryNonceVersion) == (version() >= c_binaryNonceVersion))
+    {
+        return;
+    }
+    decodeAll();
+    if (m_inner->nonceList.empty() && m_inner->nonceListBytes.empty())
+    {
+        return;
     }
+    auto nonceList = this->nonceList();
+    encodeNonceList(*m_inner, nonceList);
+    m_nonceList.set(std::move(nonceList));
 }
 
 void BlockImpl::setReceipt(size_t _index, bcos::protocol::TransactionReceipt::Ptr _receipt)
 {
+    decodeAll();
     if (_index >= m_inner->receipts.size())
     {
         m_inner->receipts.resize(m_inner->transactions.size());
@@ -89,53 +207,61 @@ void BlockImpl::setReceipt(size_t _index, bcos::protocol::TransactionReceipt::Pt
 
 void BlockImpl::appendReceipt(bcos::protocol::TransactionReceipt::Ptr _receipt)
 {
+    decodeAll();
     m_inner->receipts.emplace_back(
         std::dynamic_pointer_cast<bcostars::protocol::TransactionReceiptImpl>(_receipt)->inner());
 }
 
 void BlockImpl::setNonceList(bcos::protocol::NonceList const& _nonceList)
 {
-    m_inner->nonceList.clear();
-    m_inner->nonceList.reserve(_nonceList.size());
-    for (auto const& it : _nonceList)
-    {
-        m_inner->nonceList.emplace_back(boost::lexical_cast<std::string>(it));
-    }
-
-    m_nonceList.clear();
+    decodeAll();
+    encodeNonceList(*m_inner, _nonceList);
+    m_nonceList.reset();
 }
 
 void BlockImpl::setNonceList(bcos::protocol::NonceList&& _nonceList)
 {
-    m_inner->nonceList.clear();
-    m_inner->nonceList.reserve(_nonceList.size());
-    for (auto const& it : _nonceList)
-    {
-        m_inner->nonceList.emplace_back(boost::lexical_cast<std::string>(it));
-    }
-
-    m_nonceList.clear();
+    decodeAll();
+    encodeNonceList(*m_inner, _nonceList);
+    m_nonceList.set(std::move(_nonceList));
 }
 bcos::protocol::NonceList const& BlockImpl::nonceList() const
 {
-    if (m_nonceList.empty())
-    {
-        m_nonceList.reserve(m_inner->nonceList.size());
-
+    return m_nonceList.get([this]() {
+        if (m_lazy)
+        {
+            m_lazy->materializeRest();
+        }
+        bcos::protocol::NonceList nonceList;
+        if (!m_inner->nonceListBytes.empty())
+        {
+            if (m_inner->nonceListBytes.size() % c_binaryNonceSize != 0)
+            {
+                BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Invalid nonce list size!"));
+            }
+            auto count = m_inner->nonceListBytes.size() / c_binaryNonceSize;
+            nonceList.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                nonceList.push_back(
+                    decodeBinaryNonce(m_inner->nonceListBytes.data() + i * c_binaryNonceSize));
+            }
+            return nonceList;
+        }
+        nonceList.reserve(m_inner->nonceList.size());
         for (auto const& it : m_inner->nonceList)
         {
             if (it.empty())
             {
-                m_nonceList.push_back(bcos::protocol::NonceType(0));
+                nonceList.push_back(bcos::protocol::NonceType(0));
             }
             else
             {
-                m_nonceList.push_back(boost::lexical_cast<bcos::u256>(it));
+                nonceList.push_back(parseDecimalU256(it));
             }
         }
-    }
-
-    return m_nonceList;
+        return nonceList;
+    });
 }
 
 bcos::protocol::TransactionMetaData::ConstPtr BlockImpl::transactionMetaData(size_t _index) const
@@ -153,6 +279,7 @@ bcos::protocol::TransactionMetaData::ConstPtr BlockImpl::transactionMetaData(siz
 
 void BlockImpl::appendTransactionMetaData(bcos::protocol::TransactionMetaData::Ptr _txMetaData)
 {
+    decodeAll();
     auto txMetaDataImpl =
         std::dynamic_pointer_cast<bcostars::protocol::TransactionMetaDataImpl>(_txMetaData);
     m_inner->transactionsMetaData.emplace_back(txMetaDataImpl->inner());
@@ -160,5 +287,9 @@ void BlockImpl::appendTransactionMetaData(bcos::protocol::TransactionMetaData::P
 
 size_t BlockImpl::transactionsMetaDataSize() const
 {
+    if (m_lazy)
+    {
+        m_lazy->materializeRest();
+    }
     return m_inner->transactionsMetaData.size();
 }
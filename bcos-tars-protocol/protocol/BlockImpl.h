@@ -20,6 +20,8 @@
  */
 #pragma once
 #include "BlockHeaderImpl.h"
+#include "LazyBlock.h"
+#include "LazyValue.h"
 #include "TransactionImpl.h"
 #include "TransactionMetaDataImpl.h"
 #include "TransactionReceiptImpl.h"
@@ -50,9 +52,15 @@ public:
 
     void decode(bcos::bytesConstRef _data, bool _calculateHash, bool _checkSig) override;
     void encode(bcos::bytes& _encodeData) const override;
+    // decodes the header only, and the transactions and the receipts one by one at their first
+    // access, e.g. for reading a few of them from a large block
+    // Note: the block decodes the lists into itself once used as a whole, e.g. by encode or by
+    // the setters, and the transactions and receipts got before are detached from it then, so
+    // the later changes to them, e.g. forceSender or setImportTime, are lost by the block
+    void decodeLazily(std::shared_ptr<bcos::bytes const> _encodedBlock);
 
     int32_t version() const override { return m_inner->blockHeader.data.version; }
-    void setVersion(int32_t _version) override { m_inner->blockHeader.data.version = _version; }
+    void setVersion(int32_t _version) override;
 
     bcos::protocol::BlockType blockType() const override
     {
@@ -77,11 +85,13 @@ public:
 
     void setTransaction(size_t _index, bcos::protocol::Transaction::Ptr _transaction) override
     {
+        decodeAll();
         m_inner->transactions[_index] =
             std::dynamic_pointer_cast<bcostars::protocol::TransactionImpl>(_transaction)->inner();
     }
     void appendTransaction(bcos::protocol::Transaction::Ptr _transaction) override
     {
+        decodeAll();
         m_inner->transactions.emplace_back(
             std::dynamic_pointer_cast<bcostars::protocol::TransactionImpl>(_transaction)->inner());
     }
@@ -92,22 +102,78 @@ public:
     void appendTransactionMetaData(bcos::protocol::TransactionMetaData::Ptr _txMetaData) override;
 
     // get transactions size
-    size_t transactionsSize() const override { return m_inner->transactions.size(); }
+    size_t transactionsSize() const override
+    {
+        return lazy() ? m_lazy->transactionsSize() : m_inner->transactions.size();
+    }
     size_t transactionsMetaDataSize() const override;
     // get receipts size
-    size_t receiptsSize() const override { return m_inner->receipts.size(); }
+    size_t receiptsSize() const override
+    {
+        return lazy() ? m_lazy->receiptsSize() : m_inner->receipts.size();
+    }
 
     void setNonceList(bcos::protocol::NonceList const& _nonceList) override;
     void setNonceList(bcos::protocol::NonceList&& _nonceList) override;
     bcos::protocol::NonceList const& nonceList() const override;
 
-    const bcostars::Block& inner() const { return *m_inner; }
-    void setInner(const bcostars::Block& inner) { *m_inner = inner; }
-    void setInner(bcostars::Block&& inner) { *m_inner = std::move(inner); }
+    const bcostars::Block& inner() const
+    {
+        if (m_lazy)
+        {
+            m_lazy->materialize();
+        }
+        return *m_inner;
+    }
+    void setInner(const bcostars::Block& inner)
+    {
+        *m_inner = inner;
+        resetLazy();
+        m_nonceList.reset();
+    }
+    void setInner(bcostars::Block&& inner)
+    {
+        *m_inner = std::move(inner);
+        resetLazy();
+        m_nonceList.reset();
+    }
 
 private:
+    bool lazy() const { return m_lazy && m_lazy->lazy(); }
+    void dropHeaderHashData()
+    {
+        if (m_lazy)
+        {
+            m_lazy->dropHeaderHashData();
+        }
+    }
+    // the nonce list is encoded by the version, so re-encodes it if the version crosses
+    // c_binaryNonceVersion
+    void reencodeNonceList(int32_t _oldVersion);
+    // before modifying the lists of the lazily decoded block
+    void decodeAll()
+    {
+        if (m_lazy)
+        {
+            m_lazy->materialize();
+            resetLazy();
+        }
+    }
+    // the objects handed out before may still refer to the encoded block, whose data is no
+    // longer the preimage of their hashes once the block is modified
+    void resetLazy()
+    {
+        if (m_lazy)
+        {
+            m_lazy->dropHashData();
+            m_lazy.reset();
+        }
+    }
+
     std::shared_ptr<bcostars::Block> m_inner;
-    mutable bcos::protocol::NonceList m_nonceList;
+    // only of the lazily decoded block
+    LazyBlock::Ptr m_lazy;
+    LazyValue<bcos::protocol::NonceList> m_nonceList;
     std::shared_ptr<std::mutex> x_mutex;
 };
 }  // namespace protocol
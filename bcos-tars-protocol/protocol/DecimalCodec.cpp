@@ -0,0 +1,171 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the decimal strings of the u256 fields, e.g. the nonces and gasUsed
+ * @file DecimalCodec.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "DecimalCodec.h"
+#include <boost/endian/conversion.hpp>
+#include <boost/lexical_cast.hpp>
+#include <array>
+#include <charconv>
+#include <cstring>
+
+using namespace bcostars;
+using namespace bcostars::protocol;
+
+namespace
+{
+// the digits of the max u256
+constexpr size_t c_maxU256Digits = 78;
+// the digits of a chunk accumulated in uint64_t before multiplied into the u256
+constexpr size_t c_chunkDigits = 19;
+constexpr uint64_t c_chunkBase = 10000000000000000000ULL;
+
+constexpr std::array<uint64_t, c_chunkDigits + 1> c_powersOf10 = {1ULL, 10ULL, 100ULL, 1000ULL,
+    10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+    c_chunkBase};
+
+constexpr bool c_littleEndian = boost::endian::order::native == boost::endian::order::little;
+
+uint64_t loadEight(const char* _data)
+{
+    uint64_t value;
+    std::memcpy(&value, _data, sizeof(value));
+    return value;
+}
+
+// whether all the eight bytes are '0'~'9', the high nibbles must be 3 and adding 6 must not carry
+// any low nibble
+bool isEightDigits(uint64_t _value)
+{
+    return ((_value & 0xF0F0F0F0F0F0F0F0ULL) |
+               (((_value + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+           0x3333333333333333ULL;
+}
+
+// the eight digits loaded in the little-endian order, the first digit in the lowest byte, are
+// combined into pairs, quads and at last the number
+uint64_t parseEightDigits(uint64_t _value)
+{
+    _value = ((_value & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+    _value = ((_value & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+    return ((_value & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+}
+
+bool isPlainDecimal(std::string_view _text)
+{
+    if (_text.empty() || _text.size() > c_maxU256Digits || (_text.size() > 1 && _text[0] == '0'))
+    {
+        return false;
+    }
+    size_t offset = 0;
+    if constexpr (c_littleEndian)
+    {
+        for (; offset + 8 <= _text.size(); offset += 8)
+        {
+            if (!isEightDigits(loadEight(_text.data() + offset)))
+            {
+                return false;
+            }
+        }
+    }
+    for (; offset < _text.size(); ++offset)
+    {
+        if (_text[offset] < '0' || _text[offset] > '9')
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// at most c_chunkDigits digits
+uint64_t parseChunk(const char* _data, size_t _size)
+{
+    uint64_t value = 0;
+    size_t offset = 0;
+    if constexpr (c_littleEndian)
+    {
+        for (; offset + 8 <= _size; offset += 8)
+        {
+            value = value * 100000000ULL + parseEightDigits(loadEight(_data + offset));
+        }
+    }
+    for (; offset < _size; ++offset)
+    {
+        value = value * 10 + (uint64_t)(_data[offset] - '0');
+    }
+    return value;
+}
+}  // namespace
+
+bcos::u256 bcostars::protocol::parseDecimalU256(std::string_view _text)
+{
+    if (!isPlainDecimal(_text))
+    {
+        return boost::lexical_cast<bcos::u256>(std::string(_text));
+    }
+    // the first chunk takes the remainder digits, so the others are full
+    auto firstSize = _text.size() % c_chunkDigits;
+    if (firstSize == 0)
+    {
+        firstSize = c_chunkDigits;
+    }
+    bcos::u256 value = parseChunk(_text.data(), firstSize);
+    for (auto offset = firstSize; offset < _text.size(); offset += c_chunkDigits)
+    {
+        // the numbers over the u256 wrap around as lexical_cast does for the unchecked u256
+        value = value * c_chunkBase + parseChunk(_text.data() + offset, c_chunkDigits);
+    }
+    return value;
+}
+
+std::string bcostars::protocol::formatDecimalU256(bcos::u256 const& _value)
+{
+    // the digits of every chunk of c_chunkDigits digits, from the least significant
+    std::array<uint64_t, c_maxU256Digits / c_chunkDigits + 1> chunks;
+    size_t chunkCount = 0;
+    bcos::u256 value = _value;
+    while (value >= c_chunkBase)
+    {
+        bcos::u256 quotient;
+        bcos::u256 remainder;
+        boost::multiprecision::divide_qr(value, bcos::u256(c_chunkBase), quotient, remainder);
+        chunks[chunkCount++] = remainder.convert_to<uint64_t>();
+        value = std::move(quotient);
+    }
+
+    std::array<char, c_maxU256Digits> buffer;
+    auto end = std::to_chars(buffer.data(), buffer.data() + buffer.size(),
+        value.convert_to<uint64_t>())
+                   .ptr;
+    // the lower chunks are padded with the leading zeros
+    while (chunkCount > 0)
+    {
+        auto chunk = chunks[--chunkCount];
+        for (size_t i = c_chunkDigits; i > 0; --i)
+        {
+            end[i - 1] = (char)('0' + chunk % 10);
+            chunk /= 10;
+        }
+        end += c_chunkDigits;
+    }
+    return std::string(buffer.data(), end);
+}
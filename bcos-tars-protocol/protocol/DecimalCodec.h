@@ -0,0 +1,38 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the decimal strings of the u256 fields, e.g. the nonces and gasUsed
+ * @file DecimalCodec.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <bcos-framework/libutilities/Common.h>
+#include <string>
+#include <string_view>
+
+namespace bcostars
+{
+namespace protocol
+{
+// the same as boost::lexical_cast<bcos::u256>, including the exceptions of the bad texts; the
+// plain decimals are parsed eight digits at a time, and the others, e.g. the octal "0..." and
+// the hex "0x...", fall back to lexical_cast
+bcos::u256 parseDecimalU256(std::string_view _text);
+
+// the same as boost::lexical_cast<std::string>(_value)
+std::string formatDecimalU256(bcos::u256 const& _value);
+}  // namespace protocol
+}  // namespace bcostars
@@ -0,0 +1,57 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the 32 bytes hashes carried by the vector<byte> fields of the tars structs
+ * @file HashField.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <bcos-framework/interfaces/crypto/CommonType.h>
+#include <tup/Tars.h>
+#include <algorithm>
+#include <vector>
+
+namespace bcostars
+{
+namespace protocol
+{
+// whether the field carries a hash, the fields of the other sizes, e.g. empty if not calculated
+// yet or malformed, are to be calculated again
+inline bool hasHash(std::vector<tars::Char> const& _field)
+{
+    return _field.size() == bcos::crypto::HashType::size;
+}
+
+// the zero hash if the field is not of the hash size, e.g. not calculated yet, instead of reading
+// past the short fields
+inline bcos::crypto::HashType hashFromField(std::vector<tars::Char> const& _field)
+{
+    if (!hasHash(_field))
+    {
+        return bcos::crypto::HashType();
+    }
+    return bcos::crypto::HashType(
+        reinterpret_cast<const bcos::byte*>(_field.data()), bcos::crypto::HashType::size);
+}
+
+// the buffer of the field is reused if it has been of the hash size
+inline void assignHash(std::vector<tars::Char>& _field, bcos::crypto::HashType const& _hash)
+{
+    _field.resize(bcos::crypto::HashType::size);
+    std::copy(_hash.begin(), _hash.end(), reinterpret_cast<bcos::byte*>(_field.data()));
+}
+}  // namespace protocol
+}  // namespace bcostars
@@ -0,0 +1,410 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the encoded block decoded on demand
+ * @file LazyBlock.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "LazyBlock.h"
+#include "WireCodec.h"
+#include <tup/Tars.h>
+#include <algorithm>
+
+using namespace bcostars;
+using namespace bcostars::protocol;
+
+namespace
+{
+// the fields of the struct after _head, up to the head of its end, which is read
+bool readStructRange(WireReader& _reader, WireHead const& _head, size_t& _begin, size_t& _end)
+{
+    if (_head.type != WireType::StructBegin)
+    {
+        return false;
+    }
+    _begin = _reader.offset();
+    while (true)
+    {
+        auto offset = _reader.offset();
+        WireHead head;
+        if (!_reader.readHead(head))
+        {
+            return false;
+        }
+        if (head.type == WireType::StructEnd)
+        {
+            _end = offset;
+            return true;
+        }
+        if (!_reader.skipField(head))
+        {
+            return false;
+        }
+    }
+}
+
+bool readInt32Field(WireReader& _reader, uint8_t _tag, tars::Int32& _value)
+{
+    WireHead head;
+    switch (_reader.findField(_tag, head))
+    {
+    case FieldState::Absent:
+        return true;
+    case FieldState::Present:
+    {
+        int64_t value;
+        if (!_reader.readInt(head, WireType::Int32, value))
+        {
+            return false;
+        }
+        _value = (tars::Int32)value;
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+void readFrom(bcos::bytesConstRef _data, bcostars::Block& _block)
+{
+    tars::TarsInputStream<tars::BufferReader> input;
+    input.setBuffer((const char*)_data.data(), _data.size());
+    _block.readFrom(input);
+}
+
+void moveRest(bcostars::Block& _from, bcostars::Block& _to)
+{
+    _to.transactionsMetaData = std::move(_from.transactionsMetaData);
+    _to.receiptsHash = std::move(_from.receiptsHash);
+    _to.nonceList = std::move(_from.nonceList);
+    _to.nonceListBytes = std::move(_from.nonceListBytes);
+}
+}  // namespace
+
+LazyBlock::Ptr LazyBlock::open(
+    std::shared_ptr<bcos::bytes const> _encodedBlock, std::shared_ptr<bcostars::Block> _block)
+{
+    *_block = bcostars::Block();
+    WireReader reader((const char*)_encodedBlock->data(), _encodedBlock->size());
+    if (!readInt32Field(reader, 1, _block->version) || !readInt32Field(reader, 2, _block->type))
+    {
+        return nullptr;
+    }
+    WireHead head;
+    bcos::bytesConstRef headerHashData;
+    switch (reader.findField(3, head))
+    {
+    case FieldState::Absent:
+        break;
+    case FieldState::Present:
+    {
+        size_t begin = 0;
+        size_t end = 0;
+        if (!readStructRange(reader, head, begin, end))
+        {
+            return nullptr;
+        }
+        readBlockHeaderWithHashData(bcos::bytesConstRef(_encodedBlock->data() + begin, end - begin),
+            _block->blockHeader, headerHashData);
+        break;
+    }
+    default:
+        return nullptr;
+    }
+    auto listsOffset = reader.offset();
+    auto lazyBlock = Ptr(new LazyBlock(std::move(_encodedBlock), std::move(_block), listsOffset));
+    lazyBlock->m_headerHashData = headerHashData;
+    return lazyBlock;
+}
+
+bool LazyBlock::lazy()
+{
+    if (m_materialized.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(x_mutex);
+    index();
+    if (m_unusual)
+    {
+        materializeLocked();
+        return false;
+    }
+    return true;
+}
+
+size_t LazyBlock::transactionsSize()
+{
+    std::lock_guard<std::mutex> lock(x_mutex);
+    index();
+    if (m_unusual)
+    {
+        materializeLocked();
+        return m_block->transactions.size();
+    }
+    return m_transactionRanges.size();
+}
+
+size_t LazyBlock::receiptsSize()
+{
+    std::lock_guard<std::mutex> lock(x_mutex);
+    index();
+    if (m_unusual)
+    {
+        materializeLocked();
+        return m_block->receipts.size();
+    }
+    return m_receiptRanges.size();
+}
+
+std::shared_ptr<bcostars::Transaction> LazyBlock::transaction(size_t _index)
+{
+    return element(_index, m_transactionRanges, m_transactions, m_transactionHashData,
+        &bcostars::Block::transactions, readTransactionWithHashData);
+}
+
+std::shared_ptr<bcostars::TransactionReceipt> LazyBlock::receipt(size_t _index)
+{
+    return element(_index, m_receiptRanges, m_receipts, m_receiptHashData,
+        &bcostars::Block::receipts, readTransactionReceiptWithHashData);
+}
+
+bcos::bytesConstRef LazyBlock::headerHashData()
+{
+    std::lock_guard<std::mutex> lock(x_mutex);
+    return m_headerHashData;
+}
+
+bcos::bytesConstRef LazyBlock::transactionHashData(size_t _index)
+{
+    return hashData(_index, m_transactionHashData);
+}
+
+bcos::bytesConstRef LazyBlock::receiptHashData(size_t _index)
+{
+    return hashData(_index, m_receiptHashData);
+}
+
+void LazyBlock::dropHeaderHashData()
+{
+    std::lock_guard<std::mutex> lock(x_mutex);
+    m_headerHashData = bcos::bytesConstRef();
+}
+
+void LazyBlock::dropHashData()
+{
+    std::lock_guard<std::mutex> lock(x_mutex);
+    m_headerHashData = bcos::bytesConstRef();
+    std::fill(m_transactionHashData.begin(), m_transactionHashData.end(), bcos::bytesConstRef());
+    std::fill(m_receiptHashData.begin(), m_receiptHashData.end(), bcos::bytesConstRef());
+}
+
+bcos::bytesConstRef LazyBlock::hashData(
+    size_t _index, std::vector<bcos::bytesConstRef> const& _hashData)
+{
+    std::lock_guard<std::mutex> lock(x_mutex);
+    return _index < _hashData.size() ? _hashData[_index] : bcos::bytesConstRef();
+}
+
+template <typename Element>
+std::shared_ptr<Element> LazyBlock::element(size_t _index, std::vector<Range> const& _ranges,
+    std::vector<std::shared_ptr<Element>>& _elements, std::vector<bcos::bytesConstRef>& _hashData,
+    std::vector<Element> bcostars::Block::*_list,
+    void (*_read)(bcos::bytesConstRef, Element&, bcos::bytesConstRef&))
+{
+    std::unique_lock<std::mutex> lock(x_mutex);
+    index();
+    if (m_unusual)
+    {
+        materializeLocked();
+        // a copy instead of the element in the list of the block, which is reallocated by
+        // appending to the list
+        auto const& list = (*m_block).*_list;
+        auto const& decoded = list.at(_index);
+        if (_elements.size() < list.size())
+        {
+            _elements.resize(list.size());
+        }
+        if (!_elements[_index])
+        {
+            _elements[_index] = std::make_shared<Element>(decoded);
+        }
+        return _elements[_index];
+    }
+    auto range = _ranges.at(_index);
+    if (_elements[_index])
+    {
+        return _elements[_index];
+    }
+    lock.unlock();
+
+    // the others can be decoded meanwhile, and the first decoded one is kept
+    auto element = std::make_shared<Element>();
+    bcos::bytesConstRef hashData;
+    _read(slice(range.begin, range.end), *element, hashData);
+
+    lock.lock();
+    if (!_elements[_index])
+    {
+        _elements[_index] = std::move(element);
+        _hashData[_index] = hashData;
+    }
+    return _elements[_index];
+}
+
+void LazyBlock::materializeRest()
+{
+    if (m_restMaterialized.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(x_mutex);
+    materializeRestLocked();
+}
+
+void LazyBlock::materialize()
+{
+    if (m_materialized.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(x_mutex);
+    materializeLocked();
+}
+
+void LazyBlock::index()
+{
+    if (m_indexed)
+    {
+        return;
+    }
+    m_indexed = true;
+    WireReader reader((const char*)m_encodedBlock->data(), m_encodedBlock->size());
+    reader.seek(m_listsOffset);
+    if (!indexList(reader, 4, m_transactionRanges) || !indexList(reader, 5, m_receiptRanges))
+    {
+        m_unusual = true;
+        return;
+    }
+    m_restOffset = reader.offset();
+    // the rest is read on its own, so it must not have the tags before
+    WireHead head;
+    if (!reader.eof() && (!reader.readHead(head) ||
+                             (head.type != WireType::StructEnd && head.tag <= 5)))
+    {
+        m_unusual = true;
+        return;
+    }
+    m_transactions.resize(m_transactionRanges.size());
+    m_receipts.resize(m_receiptRanges.size());
+    m_transactionHashData.resize(m_transactionRanges.size());
+    m_receiptHashData.resize(m_receiptRanges.size());
+}
+
+bool LazyBlock::indexList(WireReader& _reader, uint8_t _tag, std::vector<Range>& _ranges) const
+{
+    WireHead head;
+    auto state = _reader.findField(_tag, head);
+    if (state != FieldState::Present)
+    {
+        return state == FieldState::Absent;
+    }
+    size_t size;
+    if (!_reader.readListSize(head, size))
+    {
+        return false;
+    }
+    _ranges.reserve(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        Range range;
+        if (!_reader.readHead(head) || head.tag != 0 ||
+            !readStructRange(_reader, head, range.begin, range.end))
+        {
+            _ranges.clear();
+            return false;
+        }
+        _ranges.push_back(range);
+    }
+    return true;
+}
+
+void LazyBlock::materializeRestLocked()
+{
+    if (m_restMaterialized.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    index();
+    if (m_unusual)
+    {
+        materializeLocked();
+        return;
+    }
+    bcostars::Block rest;
+    readFrom(slice(m_restOffset, m_encodedBlock->size()), rest);
+    moveRest(rest, *m_block);
+    m_restMaterialized.store(true, std::memory_order_release);
+}
+
+void LazyBlock::materializeLocked()
+{
+    if (m_materialized.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    index();
+    auto& block = *m_block;
+    if (m_unusual)
+    {
+        bcostars::Block decoded;
+        readFrom(bcos::ref(*m_encodedBlock), decoded);
+        block.transactions = std::move(decoded.transactions);
+        block.receipts = std::move(decoded.receipts);
+        moveRest(decoded, block);
+    }
+    else
+    {
+        // the elements decoded before are copied, so they keep the hashes calculated
+        block.transactions.resize(m_transactionRanges.size());
+        for (size_t i = 0; i < m_transactionRanges.size(); ++i)
+        {
+            if (m_transactions[i])
+            {
+                block.transactions[i] = *m_transactions[i];
+                continue;
+            }
+            auto const& range = m_transactionRanges[i];
+            readTransactionWithHashData(
+                slice(range.begin, range.end), block.transactions[i], m_transactionHashData[i]);
+        }
+        block.receipts.resize(m_receiptRanges.size());
+        for (size_t i = 0; i < m_receiptRanges.size(); ++i)
+        {
+            if (m_receipts[i])
+            {
+                block.receipts[i] = *m_receipts[i];
+                continue;
+            }
+            auto const& range = m_receiptRanges[i];
+            readTransactionReceiptWithHashData(
+                slice(range.begin, range.end), block.receipts[i], m_receiptHashData[i]);
+        }
+        materializeRestLocked();
+    }
+    m_restMaterialized.store(true, std::memory_order_release);
+    m_materialized.store(true, std::memory_order_release);
+}
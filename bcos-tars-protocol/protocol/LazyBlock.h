@@ -0,0 +1,128 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the encoded block decoded on demand
+ * @file LazyBlock.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/tars/Block.h"
+#include <bcos-framework/libutilities/Common.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace bcostars
+{
+namespace protocol
+{
+class WireReader;
+
+// keeps the encoded block whose header is decoded at opening, the offsets of the transactions and
+// the receipts are recorded at the first use of the lists, and each of them is decoded at its first
+// access; the lists are decoded into the block as a whole only when it is used as a whole
+// Note: the malformed lists throw at their first use instead of at opening
+class LazyBlock
+{
+public:
+    using Ptr = std::shared_ptr<LazyBlock>;
+
+    // reads the version, the type and the header into _block, nullptr if the fields before the
+    // lists are not of the known layout, and the block must be decoded eagerly then
+    static Ptr open(
+        std::shared_ptr<bcos::bytes const> _encodedBlock, std::shared_ptr<bcostars::Block> _block);
+
+    // false once the lists are decoded into the block, which is done here if they are not of the
+    // known layout, e.g. of a newer version
+    bool lazy();
+    size_t transactionsSize();
+    size_t receiptsSize();
+    // decoded at the first access, and the later ones get the same object, which is copied into
+    // the block by materialize, so the changes to it after that are not seen by the block
+    std::shared_ptr<bcostars::Transaction> transaction(size_t _index);
+    std::shared_ptr<bcostars::TransactionReceipt> receipt(size_t _index);
+
+    // the encoded data of the header, the transaction or the receipt, i.e. the preimage of its
+    // data hash, recorded when it is decoded by hand, and referring to encodedBlock(); empty if
+    // not decoded yet, not encoded as writeTo does, or dropped as the header may be modified
+    bcos::bytesConstRef headerHashData();
+    bcos::bytesConstRef transactionHashData(size_t _index);
+    bcos::bytesConstRef receiptHashData(size_t _index);
+    void dropHeaderHashData();
+    // once the block is no longer backed by the encoded block, e.g. its lists are modified
+    void dropHashData();
+    std::shared_ptr<bcos::bytes const> const& encodedBlock() const { return m_encodedBlock; }
+
+    // decodes the lists after the receipts into the block, e.g. the nonces, only once
+    void materializeRest();
+    // decodes all the lists into the block, only once
+    void materialize();
+
+private:
+    // the fields of an element, without its struct head and end
+    struct Range
+    {
+        size_t begin;
+        size_t end;
+    };
+
+    LazyBlock(std::shared_ptr<bcos::bytes const> _encodedBlock,
+        std::shared_ptr<bcostars::Block> _block, size_t _listsOffset)
+      : m_encodedBlock(std::move(_encodedBlock)),
+        m_block(std::move(_block)),
+        m_listsOffset(_listsOffset)
+    {}
+
+    // with x_mutex held
+    void index();
+    bool indexList(WireReader& _reader, uint8_t _tag, std::vector<Range>& _ranges) const;
+    void materializeRestLocked();
+    void materializeLocked();
+
+    template <typename Element>
+    std::shared_ptr<Element> element(size_t _index, std::vector<Range> const& _ranges,
+        std::vector<std::shared_ptr<Element>>& _elements,
+        std::vector<bcos::bytesConstRef>& _hashData, std::vector<Element> bcostars::Block::*_list,
+        void (*_read)(bcos::bytesConstRef, Element&, bcos::bytesConstRef&));
+    bcos::bytesConstRef hashData(size_t _index, std::vector<bcos::bytesConstRef> const& _hashData);
+    bcos::bytesConstRef slice(size_t _begin, size_t _end) const
+    {
+        return bcos::bytesConstRef(m_encodedBlock->data() + _begin, _end - _begin);
+    }
+
+    std::shared_ptr<bcos::bytes const> m_encodedBlock;
+    std::shared_ptr<bcostars::Block> m_block;
+    size_t m_listsOffset;
+
+    std::mutex x_mutex;
+    bool m_indexed = false;
+    // the lists are not of the known layout, so they are decoded by the generated readFrom
+    bool m_unusual = false;
+    std::vector<Range> m_transactionRanges;
+    std::vector<Range> m_receiptRanges;
+    // where the fields after the receipts begin
+    size_t m_restOffset = 0;
+    std::vector<std::shared_ptr<bcostars::Transaction>> m_transactions;
+    std::vector<std::shared_ptr<bcostars::TransactionReceipt>> m_receipts;
+    bcos::bytesConstRef m_headerHashData;
+    std::vector<bcos::bytesConstRef> m_transactionHashData;
+    std::vector<bcos::bytesConstRef> m_receiptHashData;
+    std::atomic<bool> m_restMaterialized = false;
+    std::atomic<bool> m_materialized = false;
+};
+}  // namespace protocol
+}  // namespace bcostars
@@ -0,0 +1,122 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the fields decoded once on the first read and shared by the concurrent readers
+ * @file LazyValue.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace bcostars
+{
+namespace protocol
+{
+// the first reader decodes the value and the others arriving meanwhile wait for it, after that the
+// reads are an acquire load without any lock; the failed decode, e.g. throwing on the bad nonce,
+// leaves the value empty for the next reader to retry
+// Note: reset and set must not race with the readers, as the setters of the protocol objects
+template <typename T>
+class LazyValue
+{
+public:
+    LazyValue() = default;
+    LazyValue(LazyValue const& _other)
+    {
+        if (_other.m_state.load(std::memory_order_acquire) == c_ready)
+        {
+            set(_other.value());
+        }
+    }
+    LazyValue& operator=(LazyValue const& _other)
+    {
+        if (this != &_other)
+        {
+            reset();
+            if (_other.m_state.load(std::memory_order_acquire) == c_ready)
+            {
+                set(_other.value());
+            }
+        }
+        return *this;
+    }
+    ~LazyValue() { reset(); }
+
+    template <typename Decode>
+    T const& get(Decode&& _decode) const
+    {
+        auto state = m_state.load(std::memory_order_acquire);
+        while (state != c_ready)
+        {
+            if (state == c_empty && m_state.compare_exchange_weak(state, c_decoding,
+                                        std::memory_order_acquire, std::memory_order_acquire))
+            {
+                try
+                {
+                    new (&m_storage) T(_decode());
+                }
+                catch (...)
+                {
+                    m_state.store(c_empty, std::memory_order_release);
+                    throw;
+                }
+                m_state.store(c_ready, std::memory_order_release);
+                break;
+            }
+            if (state == c_decoding)
+            {
+                std::this_thread::yield();
+                state = m_state.load(std::memory_order_acquire);
+            }
+        }
+        return value();
+    }
+
+    bool ready() const { return m_state.load(std::memory_order_acquire) == c_ready; }
+
+    template <typename Value>
+    void set(Value&& _value)
+    {
+        reset();
+        new (&m_storage) T(std::forward<Value>(_value));
+        m_state.store(c_ready, std::memory_order_release);
+    }
+
+    void reset()
+    {
+        if (m_state.load(std::memory_order_acquire) == c_ready)
+        {
+            value().~T();
+        }
+        m_state.store(c_empty, std::memory_order_release);
+    }
+
+private:
+    static constexpr uint8_t c_empty = 0;
+    static constexpr uint8_t c_decoding = 1;
+    static constexpr uint8_t c_ready = 2;
+
+    T const& value() const { return *std::launder(reinterpret_cast<T const*>(&m_storage)); }
+
+    mutable std::atomic<uint8_t> m_state = {c_empty};
+    alignas(T) mutable unsigned char m_storage[sizeof(T)];
+};
+}  // namespace protocol
+}  // namespace bcostars
@@ -0,0 +1,101 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief read-only view over the binary merkle proof
+ * @file MerkleProofView.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "MerkleProofView.h"
+#include <bcos-framework/libutilities/DataConvertUtility.h>
+#include <bcos-framework/libutilities/Error.h>
+
+using namespace bcostars;
+using namespace bcostars::protocol;
+
+bcostars::MerkleProofBlob MerkleProofView::encode(bcos::ledger::MerkleProof const& _proof)
+{
+    bcostars::MerkleProofBlob blob;
+    blob.siblingOffsets.reserve(_proof.size() * 2 + 1);
+    blob.siblingOffsets.push_back(0);
+    tars::Int32 siblingCount = 0;
+    auto appendSiblings = [&blob, &siblingCount](std::vector<std::string> const& _siblings) {
+        for (auto const& sibling : _siblings)
+        {
+            auto hash = bcos::fromHex(sibling);
+            if (siblingCount == 0)
+            {
+                blob.hashSize = hash.size();
+            }
+            else if ((tars::Int32)hash.size() != blob.hashSize)
+            {
+                BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Inconsistent merkle proof hash size!"));
+            }
+            blob.hashes.insert(blob.hashes.end(), hash.begin(), hash.end());
+            siblingCount++;
+        }
+        blob.siblingOffsets.push_back(siblingCount);
+    };
+    for (auto const& item : _proof)
+    {
+        appendSiblings(item.first);
+        appendSiblings(item.second);
+    }
+    return blob;
+}
+
+bool MerkleProofView::valid() const
+{
+    auto const& offsets = m_inner.siblingOffsets;
+    if (offsets.empty())
+    {
+        return m_inner.hashes.empty();
+    }
+    if (offsets.size() % 2 == 0 || offsets.front() != 0 || m_inner.hashSize < 0)
+    {
+        return false;
+    }
+    for (size_t i = 1; i < offsets.size(); ++i)
+    {
+        if (offsets[i] < offsets[i - 1])
+        {
+            return false;
+        }
+    }
+    return (size_t)offsets.back() * m_inner.hashSize == m_inner.hashes.size();
+}
+
+bcos::ledger::MerkleProofPtr MerkleProofView::toMerkleProof() const
+{
+    auto proof = std::make_shared<bcos::ledger::MerkleProof>();
+    proof->reserve(levels());
+    for (size_t level = 0; level < levels(); ++level)
+    {
+        std::vector<std::string> leftSiblings;
+        leftSiblings.reserve(leftSize(level));
+        for (size_t i = 0; i < leftSize(level); ++i)
+        {
+            leftSiblings.emplace_back(bcos::toHex(left(level, i)));
+        }
+        std::vector<std::string> rightSiblings;
+        rightSiblings.reserve(rightSize(level));
+        for (size_t i = 0; i < rightSize(level); ++i)
+        {
+            rightSiblings.emplace_back(bcos::toHex(right(level, i)));
+        }
+        proof->emplace_back(std::move(leftSiblings), std::move(rightSiblings));
+    }
+    return proof;
+}
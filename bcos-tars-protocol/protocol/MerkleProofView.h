@@ -0,0 +1,91 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief read-only view over the binary merkle proof
+ * @file MerkleProofView.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/tars/LedgerService.h"
+#include <bcos-framework/interfaces/ledger/LedgerTypeDef.h>
+#include <bcos-framework/libutilities/Common.h>
+#include <memory>
+
+namespace bcostars
+{
+namespace protocol
+{
+// the siblings are returned as references into the blob, which is moved into the view without
+// copying the hashes
+class MerkleProofView
+{
+public:
+    using Ptr = std::shared_ptr<MerkleProofView>;
+    using ConstPtr = std::shared_ptr<const MerkleProofView>;
+
+    MerkleProofView() = default;
+    explicit MerkleProofView(bcostars::MerkleProofBlob&& _inner) : m_inner(std::move(_inner)) {}
+
+    // encode the proof with the hex string siblings into the binary proof, all the siblings must
+    // be of the same size
+    static bcostars::MerkleProofBlob encode(bcos::ledger::MerkleProof const& _proof);
+
+    // the offsets are increasing and in the range of the hashes
+    bool valid() const;
+
+    size_t levels() const
+    {
+        return m_inner.siblingOffsets.empty() ? 0 : (m_inner.siblingOffsets.size() - 1) / 2;
+    }
+    size_t hashSize() const { return m_inner.hashSize; }
+    size_t leftSize(size_t _level) const { return siblingsSize(2 * _level); }
+    size_t rightSize(size_t _level) const { return siblingsSize(2 * _level + 1); }
+    // Note: the level and the index are not checked
+    bcos::bytesConstRef left(size_t _level, size_t _index) const
+    {
+        return sibling(2 * _level, _index);
+    }
+    bcos::bytesConstRef right(size_t _level, size_t _index) const
+    {
+        return sibling(2 * _level + 1, _index);
+    }
+
+    // the proof with the hex string siblings, for the ledger interface
+    bcos::ledger::MerkleProofPtr toMerkleProof() const;
+    size_t memorySize() const
+    {
+        return sizeof(*this) + m_inner.siblingOffsets.size() * sizeof(tars::Int32) +
+               m_inner.hashes.size();
+    }
+
+    bcostars::MerkleProofBlob const& inner() const { return m_inner; }
+
+private:
+    size_t siblingsSize(size_t _group) const
+    {
+        return m_inner.siblingOffsets[_group + 1] - m_inner.siblingOffsets[_group];
+    }
+    bcos::bytesConstRef sibling(size_t _group, size_t _index) const
+    {
+        auto offset = (m_inner.siblingOffsets[_group] + _index) * m_inner.hashSize;
+        return bcos::bytesConstRef(
+            (bcos::byte const*)m_inner.hashes.data() + offset, m_inner.hashSize);
+    }
+
+    bcostars::MerkleProofBlob m_inner;
+};
+}  // namespace protocol
+}  // namespace bcostars
@@ -0,0 +1,86 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the fixed-width binary nonces of the transactions and the blocks
+ * @file NonceCodec.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "DecimalCodec.h"
+#include <bcos-framework/libutilities/Common.h>
+#include <boost/endian/conversion.hpp>
+#include <cstdint>
+#include <cstring>
+
+namespace bcostars
+{
+namespace protocol
+{
+// since the version, the nonces are carried as 32 bytes big-endian, TransactionData.nonceBytes
+// instead of TransactionData.nonce, and Block.nonceListBytes instead of Block.nonceList
+constexpr int32_t c_binaryNonceVersion = 1;
+constexpr size_t c_binaryNonceSize = 32;
+
+static_assert(sizeof(boost::multiprecision::limb_type) == sizeof(uint64_t),
+    "the binary nonces are converted by the 64 bits limbs");
+
+// writes c_binaryNonceSize bytes to _out
+inline void encodeBinaryNonce(bcos::u256 const& _nonce, void* _out)
+{
+    auto const& backend = _nonce.backend();
+    auto out = (char*)_out;
+    // the limbs are from the least significant
+    for (size_t i = 0; i < 4; ++i)
+    {
+        uint64_t limb = i < backend.size() ? backend.limbs()[i] : 0;
+        limb = boost::endian::native_to_big(limb);
+        std::memcpy(out + (3 - i) * sizeof(uint64_t), &limb, sizeof(uint64_t));
+    }
+}
+
+// reads c_binaryNonceSize bytes from _data
+inline bcos::u256 decodeBinaryNonce(const void* _data)
+{
+    auto data = (const char*)_data;
+    bcos::u256 nonce;
+    auto& backend = nonce.backend();
+    backend.resize(4, 4);
+    for (size_t i = 0; i < 4; ++i)
+    {
+        uint64_t limb;
+        std::memcpy(&limb, data + (3 - i) * sizeof(uint64_t), sizeof(uint64_t));
+        backend.limbs()[i] = boost::endian::big_to_native(limb);
+    }
+    backend.normalize();
+    return nonce;
+}
+
+// the nonce of TransactionData, from the nonceBytes if of c_binaryNonceSize, or else from the
+// decimal nonce, 0 if neither
+inline bcos::u256 decodeTransactionNonce(bcos::bytesConstRef _nonceBytes, std::string_view _nonce)
+{
+    if (_nonceBytes.size() == c_binaryNonceSize)
+    {
+        return decodeBinaryNonce(_nonceBytes.data());
+    }
+    if (!_nonce.empty())
+    {
+        return parseDecimalU256(_nonce);
+    }
+    return bcos::u256(0);
+}
+}  // namespace protocol
+}  // namespace bcostars
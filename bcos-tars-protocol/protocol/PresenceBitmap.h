@@ -0,0 +1,49 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the presence bitmap of the index-aligned responses
+ * @file PresenceBitmap.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bcostars
+{
+namespace protocol
+{
+// the bit i is (_bitmap[i / 8] >> (i % 8)) & 1, the bits out of the bitmap are not present
+template <typename Byte>
+void resetPresenceBitmap(std::vector<Byte>& _bitmap, size_t _size)
+{
+    _bitmap.assign((_size + 7) / 8, 0);
+}
+
+template <typename Byte>
+void setPresent(std::vector<Byte>& _bitmap, size_t _index)
+{
+    _bitmap[_index / 8] = (Byte)((uint8_t)_bitmap[_index / 8] | (1u << (_index % 8)));
+}
+
+template <typename Byte>
+bool isPresent(std::vector<Byte> const& _bitmap, size_t _index)
+{
+    return _index / 8 < _bitmap.size() && (((uint8_t)_bitmap[_index / 8] >> (_index % 8)) & 1);
+}
+}  // namespace protocol
+}  // namespace bcostars
@@ -19,8 +19,14 @@
  * @date 2021-04-20
  */
 #pragma once
+#include "DecimalCodec.h"
+#include "NonceCodec.h"
 #include "TransactionImpl.h"
+#include "WireCodec.h"
+#include "bcos-tars-protocol/AllocationTracker.h"
 #include <bcos-framework/interfaces/protocol/TransactionFactory.h>
+#include <algorithm>
+#include <optional>
 
 namespace bcostars
 {
@@ -36,6 +42,7 @@ public:
     bcos::protocol::Transaction::Ptr createTransaction(
         bcos::bytesConstRef _txData, bool _checkSig = true) override
     {
+        BCOS_TARS_ALLOC_SCOPE("TransactionFactoryImpl::createTransaction");
         auto transaction = std::make_shared<TransactionImpl>(m_cryptoSuite,
             [m_transaction = bcostars::Transaction()]() mutable { return &m_transaction; });
 
@@ -53,6 +60,28 @@ public:
         return createTransaction(bcos::ref(_txData), _checkSig);
     }
 
+    // the fields for the admission checks of the txpool and the hash, read without copying the
+    // input, so the transaction is decoded by createTransaction only after passing the checks;
+    // std::nullopt if it must be decoded for them, e.g. of an unknown layout, or not encoded as the
+    // generated writeTo does, or carrying a data hash other than the calculated one
+    std::optional<TransactionPrecheck> precheckTransaction(bcos::bytesConstRef _txData) const
+    {
+        BCOS_TARS_ALLOC_SCOPE("TransactionFactoryImpl::precheckTransaction");
+        TransactionPrecheck precheck;
+        if (!readTransactionPrecheck(_txData, precheck) || !precheck.canonical)
+        {
+            return std::nullopt;
+        }
+        precheck.hash = m_cryptoSuite->hash(precheck.data);
+        if (!precheck.dataHash.empty() &&
+            !std::equal(precheck.dataHash.begin(), precheck.dataHash.end(), precheck.hash.begin(),
+                precheck.hash.end()))
+        {
+            return std::nullopt;
+        }
+        return precheck;
+    }
+
     bcos::protocol::Transaction::Ptr createTransaction(int32_t _version,
         const std::string_view& _to, bcos::bytes const& _input, bcos::u256 const& _nonce,
         int64_t _blockLimit, std::string const& _chainId, std::string const& _groupId,
@@ -67,7 +96,15 @@ public:
         inner()->data.blockLimit = _blockLimit;
         inner()->data.chainID = _chainId;
         inner()->data.groupID = _groupId;
-        inner()->data.nonce = boost::lexical_cast<std::string>(_nonce);
+        if (_version >= c_binaryNonceVersion)
+        {
+            inner()->data.nonceBytes.resize(c_binaryNonceSize);
+            encodeBinaryNonce(_nonce, inner()->data.nonceBytes.data());
+        }
+        else
+        {
+            inner()->data.nonce = formatDecimalU256(_nonce);
+        }
         inner()->importTime = _importTime;
 
         return transaction;
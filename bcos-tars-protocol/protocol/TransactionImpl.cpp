@@ -19,67 +19,86 @@
  * @date 2021-04-20
  */
 #include "TransactionImpl.h"
+#include "HashField.h"
+#include "NonceCodec.h"
+#include "WireCodec.h"
+#include "bcos-tars-protocol/AllocationTracker.h"
 
 using namespace bcostars;
 using namespace bcostars::protocol;
 
 void TransactionImpl::decode(bcos::bytesConstRef _txData)
 {
+    BCOS_TARS_ALLOC_SCOPE("TransactionImpl::decode");
     m_buffer.assign(_txData.begin(), _txData.end());
+    m_dataBuffer.clear();
+    m_hashDataOwner.reset();
+    m_hashDataSource = nullptr;
 
-    tars::TarsInputStream<tars::BufferReader> input;
-    input.setBuffer((const char*)m_buffer.data(), m_buffer.size());
-
-    m_inner()->readFrom(input);
+    readTransactionWithHashData(
+        bcos::bytesConstRef(m_buffer.data(), m_buffer.size()), *m_inner(), m_hashData);
+    m_nonce.reset();
 }
 
 bcos::bytesConstRef TransactionImpl::encode(bool _onlyHashFields) const
 {
-    if (m_dataBuffer.empty())
-    {
-        tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
-        m_inner()->data.writeTo(output);
-        output.getByteBuffer().swap(m_dataBuffer);
-    }
-
+    BCOS_TARS_ALLOC_SCOPE("TransactionImpl::encode");
     if (_onlyHashFields)
     {
+        // the received data is what the writeTo would write
+        if (!m_hashData.empty())
+        {
+            return m_hashData;
+        }
+        if (m_hashDataSource)
+        {
+            auto hashData = m_hashDataSource();
+            if (!hashData.empty())
+            {
+                return hashData;
+            }
+        }
+        if (m_dataBuffer.empty())
+        {
+            tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
+            m_inner()->data.writeTo(output);
+            output.getByteBuffer().swap(m_dataBuffer);
+        }
         return bcos::ref(m_dataBuffer);
     }
-    else
+
+    if (m_buffer.empty())
     {
-        if (m_buffer.empty())
-        {
-            tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
+        tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
 
-            auto hash = m_cryptoSuite->hash(m_dataBuffer);
-            m_inner()->dataHash.assign(hash.begin(), hash.end());
-            m_inner()->writeTo(output);
-            output.getByteBuffer().swap(m_buffer);
-        }
-        return bcos::ref(m_buffer);
+        auto hash = m_cryptoSuite->hash(encode(true));
+        assignHash(m_inner()->dataHash, hash);
+        m_inner()->writeTo(output);
+        output.getByteBuffer().swap(m_buffer);
     }
+    return bcos::ref(m_buffer);
 }
 
 bcos::crypto::HashType TransactionImpl::hash() const
 {
-    if (m_inner()->dataHash.empty())
+    if (!hasHash(m_inner()->dataHash))
     {
         auto buffer = encode(true);
         auto hash = m_cryptoSuite->hash(buffer);
-        m_inner()->dataHash.assign(hash.begin(), hash.end());
+        assignHash(m_inner()->dataHash, hash);
     }
 
-    return *(reinterpret_cast<bcos::crypto::HashType*>(m_inner()->dataHash.data()));
+    return hashFromField(m_inner()->dataHash);
 }
 
 bcos::u256 TransactionImpl::nonce() const
 {
-    if (!m_inner()->data.nonce.empty())
-    {
-        m_nonce = boost::lexical_cast<bcos::u256>(m_inner()->data.nonce);
-    }
-    return m_nonce;
+    return m_nonce.get([this]() {
+        auto const& nonceBytes = m_inner()->data.nonceBytes;
+        return decodeTransactionNonce(
+            bcos::bytesConstRef((const bcos::byte*)nonceBytes.data(), nonceBytes.size()),
+            m_inner()->data.nonce);
+    });
 }
 
 bcos::bytesConstRef TransactionImpl::input() const
@@ -20,6 +20,7 @@
  */
 
 #pragma once
+#include "LazyValue.h"
 #include "bcos-tars-protocol/Common.h"
 #include "bcos-tars-protocol/tars/Transaction.h"
 #include <bcos-framework/interfaces/crypto/CommonType.h>
@@ -42,13 +43,39 @@ public:
 
     ~TransactionImpl() {}
 
+    // m_hashData may refer to m_buffer of this object
+    TransactionImpl(TransactionImpl const&) = delete;
+    TransactionImpl& operator=(TransactionImpl const&) = delete;
+
     friend class TransactionFactoryImpl;
 
     bool operator==(const Transaction& rhs) const { return this->hash() == rhs.hash(); }
 
     void decode(bcos::bytesConstRef _txData) override;
     bcos::bytesConstRef encode(bool _onlyHashFields = false) const override;
-    bcos::bytes takeEncoded() override { return std::move(m_buffer); }
+    bcos::bytes takeEncoded() override
+    {
+        m_hashData = bcos::bytesConstRef();
+        m_hashDataOwner.reset();
+        m_hashDataSource = nullptr;
+        return std::move(m_buffer);
+    }
+    // hashes _hashData, the encoded data as decoded within the block _owner, instead of writing
+    // the data again, nothing if it is empty
+    void setHashData(std::shared_ptr<bcos::bytes const> _owner, bcos::bytesConstRef _hashData)
+    {
+        if (!_hashData.empty())
+        {
+            m_hashDataOwner = std::move(_owner);
+            m_hashData = _hashData;
+        }
+    }
+    // hashes the encoded data returned by _source when hashing, for the transaction in the list
+    // of the block, which returns nothing once the list may have been modified
+    void setHashDataSource(std::function<bcos::bytesConstRef()> _source)
+    {
+        m_hashDataSource = std::move(_source);
+    }
 
     bcos::crypto::HashType hash() const override;
     int32_t version() const override { return m_inner()->data.version; }
@@ -86,7 +113,14 @@ public:
     void setSource(std::string const& source) override { m_inner()->source = source; }
 
     const bcostars::Transaction& inner() const { return *m_inner(); }
-    void setInner(bcostars::Transaction inner) { *m_inner() = std::move(inner); }
+    void setInner(bcostars::Transaction inner)
+    {
+        *m_inner() = std::move(inner);
+        m_nonce.reset();
+        m_hashData = bcos::bytesConstRef();
+        m_hashDataOwner.reset();
+        m_hashDataSource = nullptr;
+    }
 
     std::function<bcostars::Transaction*()> const& innerGetter() { return m_inner; }
 
@@ -95,7 +129,12 @@ private:
     std::function<bcostars::Transaction*()> m_inner;
     mutable bcos::bytes m_buffer;
     mutable bcos::bytes m_dataBuffer;
-    mutable bcos::u256 m_nonce;
+    // the encoded data as decoded, in m_buffer or in the block of m_hashDataOwner, used instead of
+    // m_dataBuffer if not empty
+    bcos::bytesConstRef m_hashData;
+    std::shared_ptr<bcos::bytes const> m_hashDataOwner;
+    std::function<bcos::bytesConstRef()> m_hashDataSource;
+    LazyValue<bcos::u256> m_nonce;
 };
 }  // namespace protocol
 }  // namespace bcostars
\ No newline at end of file
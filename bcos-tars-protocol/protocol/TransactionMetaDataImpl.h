@@ -19,6 +19,7 @@
  * @date: 2021-09-07
  */
 #pragma once
+#include "HashField.h"
 #include "bcos-tars-protocol/tars/TransactionMetaData.h"
 #include <bcos-framework/interfaces/protocol/TransactionMetaData.h>
 
@@ -50,19 +51,9 @@ public:
 
     bcos::crypto::HashType hash() const override
     {
-        auto const& hashBytes = m_inner()->hash;
-        if (hashBytes.size() == bcos::crypto::HashType::size)
-        {
-            bcos::crypto::HashType hash(reinterpret_cast<const bcos::byte*>(hashBytes.data()),
-                bcos::crypto::HashType::size);
-            return hash;
-        }
-        return bcos::crypto::HashType();
-    }
-    void setHash(bcos::crypto::HashType _hash) override
-    {
-        m_inner()->hash.assign(_hash.begin(), _hash.end());
+        return hashFromField(m_inner()->hash);
     }
+    void setHash(bcos::crypto::HashType _hash) override { assignHash(m_inner()->hash, _hash); }
 
     std::string_view to() const override { return m_inner()->to; }
     void setTo(std::string _to) override { m_inner()->to = std::move(_to); }
@@ -19,7 +19,9 @@
  * @date 2021-04-20
  */
 #pragma once
+#include "DecimalCodec.h"
 #include "TransactionReceiptImpl.h"
+#include "bcos-tars-protocol/AllocationTracker.h"
 #include <bcos-framework/interfaces/protocol/TransactionReceiptFactory.h>
 
 
@@ -37,6 +39,7 @@ public:
 
     TransactionReceiptImpl::Ptr createReceipt(bcos::bytesConstRef _receiptData) override
     {
+        BCOS_TARS_ALLOC_SCOPE("TransactionReceiptFactoryImpl::createReceipt");
         auto transactionReceipt = std::make_shared<TransactionReceiptImpl>(m_cryptoSuite,
             [m_receipt = bcostars::TransactionReceipt()]() mutable { return &m_receipt; });
 
@@ -61,7 +64,7 @@ public:
         // required: version
         inner()->data.version = 0;
         // required: gasUsed
-        inner()->data.gasUsed = boost::lexical_cast<std::string>(_gasUsed);
+        inner()->data.gasUsed = formatDecimalU256(_gasUsed);
         // optional: contractAddress
         inner()->data.contractAddress.assign(_contractAddress.begin(), _contractAddress.end());
         // required: status
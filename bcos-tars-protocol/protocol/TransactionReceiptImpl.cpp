@@ -19,20 +19,31 @@
  * @date 2021-04-20
  */
 #include "TransactionReceiptImpl.h"
+#include "DecimalCodec.h"
+#include "HashField.h"
+#include "WireCodec.h"
+#include "bcos-tars-protocol/AllocationTracker.h"
 
 using namespace bcostars;
 using namespace bcostars::protocol;
 
 void TransactionReceiptImpl::decode(bcos::bytesConstRef _receiptData)
 {
-    tars::TarsInputStream<tars::BufferReader> input;
-    input.setBuffer((const char*)_receiptData.data(), _receiptData.size());
-
-    m_inner()->readFrom(input);
+    BCOS_TARS_ALLOC_SCOPE("TransactionReceiptImpl::decode");
+    bcos::bytesConstRef hashData;
+    readTransactionReceiptWithHashData(_receiptData, *m_inner(), hashData);
+    m_logEntries.reset();
+    dropHashData();
+    // kept only if the hash is to be calculated, instead of writing the data again
+    if (!hasHash(m_inner()->dataHash))
+    {
+        m_dataBuffer.assign(hashData.begin(), hashData.end());
+    }
 }
 
 void TransactionReceiptImpl::encode(bcos::bytes& _encodedData) const
 {
+    BCOS_TARS_ALLOC_SCOPE("TransactionReceiptImpl::encode");
     tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
     m_inner()->writeTo(output);
     output.getByteBuffer().swap(_encodedData);
@@ -45,22 +56,37 @@ bcos::bytesConstRef TransactionReceiptImpl::encode(bool) const
 
 bcos::crypto::HashType TransactionReceiptImpl::hash() const
 {
-    if (m_inner()->dataHash.empty())
+    if (!hasHash(m_inner()->dataHash))
     {
-        tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
-        m_inner()->data.writeTo(output);
-        auto hash = m_cryptoSuite->hash(output.getByteBuffer());
-        m_inner()->dataHash.assign(hash.begin(), hash.end());
+        auto hashData = m_hashData;
+        if (hashData.empty() && m_hashDataSource)
+        {
+            hashData = m_hashDataSource();
+        }
+        if (hashData.empty())
+        {
+            if (m_dataBuffer.empty())
+            {
+                tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
+                m_inner()->data.writeTo(output);
+                output.getByteBuffer().swap(m_dataBuffer);
+            }
+            hashData = bcos::ref(m_dataBuffer);
+        }
+        auto hash = m_cryptoSuite->hash(hashData);
+        assignHash(m_inner()->dataHash, hash);
+        dropHashData();
+        bcos::bytes().swap(m_dataBuffer);
     }
 
-    return *(reinterpret_cast<const bcos::crypto::HashType*>(m_inner()->dataHash.data()));
+    return hashFromField(m_inner()->dataHash);
 }
 
 bcos::u256 TransactionReceiptImpl::gasUsed() const
 {
     if (!m_inner()->data.gasUsed.empty())
     {
-        return boost::lexical_cast<bcos::u256>(m_inner()->data.gasUsed);
+        return parseDecimalU256(m_inner()->data.gasUsed);
     }
     return {};
 }
@@ -20,6 +20,7 @@
  */
 
 #pragma once
+#include "LazyValue.h"
 #include "bcos-tars-protocol/Common.h"
 #include "bcos-tars-protocol/tars/TransactionReceipt.h"
 #include <bcos-framework/interfaces/crypto/CryptoSuite.h>
@@ -64,9 +65,9 @@ public:
     }
     gsl::span<const bcos::protocol::LogEntry> logEntries() const override
     {
-        if (m_logEntries.empty())
-        {
-            m_logEntries.reserve(m_inner()->data.logEntries.size());
+        auto const& logEntries = m_logEntries.get([this]() {
+            std::vector<bcos::protocol::LogEntry> logEntries;
+            logEntries.reserve(m_inner()->data.logEntries.size());
             for (auto& it : m_inner()->data.logEntries)
             {
                 std::vector<bcos::h256> topics;
@@ -74,26 +75,54 @@ public:
                 {
                     topics.emplace_back((const bcos::byte*)topicIt.data(), topicIt.size());
                 }
-                bcos::protocol::LogEntry logEntry(bcos::bytes(it.address.begin(), it.address.end()),
-                    topics, bcos::bytes(it.data.begin(), it.data.end()));
-                m_logEntries.emplace_back(logEntry);
+                logEntries.emplace_back(bcos::bytes(it.address.begin(), it.address.end()),
+                    std::move(topics), bcos::bytes(it.data.begin(), it.data.end()));
             }
-        }
+            return logEntries;
+        });
 
-        return gsl::span<const bcos::protocol::LogEntry>(m_logEntries.data(), m_logEntries.size());
+        return gsl::span<const bcos::protocol::LogEntry>(logEntries.data(), logEntries.size());
     }
     bcos::protocol::BlockNumber blockNumber() const override { return m_inner()->data.blockNumber; }
 
     const bcostars::TransactionReceipt& inner() const { return *m_inner(); }
 
-    void setInner(const bcostars::TransactionReceipt& inner) { *m_inner() = inner; }
-    void setInner(bcostars::TransactionReceipt&& inner) { *m_inner() = std::move(inner); }
+    void setInner(const bcostars::TransactionReceipt& inner)
+    {
+        *m_inner() = inner;
+        m_logEntries.reset();
+        dropHashData();
+    }
+    void setInner(bcostars::TransactionReceipt&& inner)
+    {
+        *m_inner() = std::move(inner);
+        m_logEntries.reset();
+        dropHashData();
+    }
 
     std::function<bcostars::TransactionReceipt*()> const& innerGetter() { return m_inner; }
 
+    // hashes _hashData, the encoded data as decoded within the block _owner, instead of writing
+    // the data again, nothing if it is empty
+    void setHashData(std::shared_ptr<bcos::bytes const> _owner, bcos::bytesConstRef _hashData)
+    {
+        if (!_hashData.empty())
+        {
+            m_hashDataOwner = std::move(_owner);
+            m_hashData = _hashData;
+        }
+    }
+    // hashes the encoded data returned by _source when hashing, for the receipt in the list of
+    // the block, which returns nothing once the list may have been modified
+    void setHashDataSource(std::function<bcos::bytesConstRef()> _source)
+    {
+        m_hashDataSource = std::move(_source);
+    }
+
     void setLogEntries(std::vector<bcos::protocol::LogEntry> const& _logEntries)
     {
-        m_logEntries.clear();
+        m_logEntries.reset();
+        dropHashData();
         m_inner()->data.logEntries.clear();
         m_inner()->data.logEntries.reserve(_logEntries.size());
 
@@ -112,8 +141,23 @@ public:
     }
 
 private:
+    // once the data is modified, the received encoding is no longer the preimage of the hash
+    void dropHashData() const
+    {
+        m_dataBuffer.clear();
+        m_hashData = bcos::bytesConstRef();
+        m_hashDataOwner.reset();
+        m_hashDataSource = nullptr;
+    }
+
     std::function<bcostars::TransactionReceipt*()> m_inner;
-    mutable std::vector<bcos::protocol::LogEntry> m_logEntries;
+    LazyValue<std::vector<bcos::protocol::LogEntry>> m_logEntries;
+    // the received encoding of the data until the hash is calculated, copied by decode, or in the
+    // block of m_hashDataOwner
+    mutable bcos::bytes m_dataBuffer;
+    mutable bcos::bytesConstRef m_hashData;
+    mutable std::shared_ptr<bcos::bytes const> m_hashDataOwner;
+    mutable std::function<bcos::bytesConstRef()> m_hashDataSource;
 };
 }  // namespace protocol
 }  // namespace bcostars
\ No newline at end of file
@@ -20,6 +20,7 @@
  */
 
 #pragma once
+#include "HashField.h"
 #include "TransactionReceiptImpl.h"
 #include "bcos-tars-protocol/Common.h"
 #include "bcos-tars-protocol/tars/TransactionReceipt.h"
@@ -52,28 +53,20 @@ public:
 
     bcos::crypto::HashType txHash() const override
     {
-        if (m_inner()->txHash.size() == bcos::crypto::HashType::size)
-        {
-            return *(reinterpret_cast<const bcos::crypto::HashType*>(m_inner()->txHash.data()));
-        }
-        return bcos::crypto::HashType();
+        return hashFromField(m_inner()->txHash);
     }
     void setTxHash(bcos::crypto::HashType txHash) override
     {
-        m_inner()->txHash.assign(txHash.begin(), txHash.end());
+        assignHash(m_inner()->txHash, txHash);
     }
 
     bcos::crypto::HashType blockHash() const override
     {
-        if (m_inner()->blockHash.size() == bcos::crypto::HashType::size)
-        {
-            return *(reinterpret_cast<const bcos::crypto::HashType*>(m_inner()->blockHash.data()));
-        }
-        return bcos::crypto::HashType();
+        return hashFromField(m_inner()->blockHash);
     }
     void setBlockHash(bcos::crypto::HashType blockHash) override
     {
-        m_inner()->blockHash.assign(blockHash.begin(), blockHash.end());
+        assignHash(m_inner()->blockHash, blockHash);
     }
 
     int64_t transactionIndex() const override { return m_inner()->transactionIndex; }
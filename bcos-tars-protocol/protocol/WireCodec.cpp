@@ -0,0 +1,810 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the hand-written readers of the hot tars structs
+ * @file WireCodec.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "WireCodec.h"
+#include "NonceCodec.h"
+#include <boost/endian/conversion.hpp>
+#include <algorithm>
+#include <cstring>
+
+using namespace bcostars;
+using namespace bcostars::protocol;
+
+namespace
+{
+// the same as TARS_MAX_STRING_LENGTH of the generated readFrom
+constexpr size_t c_maxStringLength = 100 * 1024 * 1024;
+// the deeper nested data is left to the generated readFrom
+constexpr size_t c_maxSkipDepth = 64;
+}  // namespace
+
+bool WireReader::readHead(WireHead& _head)
+{
+    if (m_offset >= m_size)
+    {
+        return false;
+    }
+    auto byte = (uint8_t)m_data[m_offset++];
+    _head.type = (WireType)(byte & 0x0F);
+    _head.tag = byte >> 4;
+    if (_head.tag == 15)
+    {
+        if (m_offset >= m_size)
+        {
+            return false;
+        }
+        _head.tag = (uint8_t)m_data[m_offset++];
+        if (_head.tag < 15)
+        {
+            m_canonical = false;
+        }
+    }
+    return true;
+}
+
+template <typename Int>
+bool WireReader::readBigEndian(Int& _value)
+{
+    if (m_size - m_offset < sizeof(Int))
+    {
+        return false;
+    }
+    std::memcpy(&_value, m_data + m_offset, sizeof(Int));
+    boost::endian::big_to_native_inplace(_value);
+    m_offset += sizeof(Int);
+    return true;
+}
+
+bool WireReader::readInt(WireHead const& _head, WireType _widest, int64_t& _value)
+{
+    // the generated writeTo takes the narrowest type holding the value, and the ZeroTag for 0
+    switch (_head.type)
+    {
+    case WireType::ZeroTag:
+        _value = 0;
+        return true;
+    case WireType::Char:
+    {
+        int8_t value;
+        if (!readBigEndian(value))
+        {
+            return false;
+        }
+        _value = value;
+        m_canonical = m_canonical && value != 0;
+        return true;
+    }
+    case WireType::Short:
+    {
+        int16_t value;
+        if (_widest == WireType::Char || !readBigEndian(value))
+        {
+            return false;
+        }
+        _value = value;
+        m_canonical = m_canonical && (value < INT8_MIN || value > INT8_MAX);
+        return true;
+    }
+    case WireType::Int32:
+    {
+        int32_t value;
+        if ((_widest != WireType::Int32 && _widest != WireType::Int64) || !readBigEndian(value))
+        {
+            return false;
+        }
+        _value = value;
+        m_canonical = m_canonical && (value < INT16_MIN || value > INT16_MAX);
+        return true;
+    }
+    case WireType::Int64:
+        if (_widest != WireType::Int64 || !readBigEndian(_value))
+        {
+            return false;
+        }
+        m_canonical = m_canonical && (_value < INT32_MIN || _value > INT32_MAX);
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool WireReader::readSize(size_t& _size)
+{
+    WireHead head;
+    int64_t size;
+    if (!readHead(head) || head.tag != 0 || !readInt(head, WireType::Int32, size) || size < 0 ||
+        (size_t)size > m_size - m_offset)
+    {
+        return false;
+    }
+    _size = (size_t)size;
+    return true;
+}
+
+bool WireReader::readString(WireHead const& _head, std::string& _value)
+{
+    std::string_view value;
+    if (!readString(_head, value))
+    {
+        return false;
+    }
+    _value.assign(value.data(), value.size());
+    return true;
+}
+
+bool WireReader::readString(WireHead const& _head, std::string_view& _value)
+{
+    size_t length;
+    if (_head.type == WireType::String1)
+    {
+        uint8_t length8;
+        if (!readBigEndian(length8))
+        {
+            return false;
+        }
+        length = length8;
+    }
+    else if (_head.type == WireType::String4)
+    {
+        uint32_t length32;
+        if (!readBigEndian(length32) || length32 > c_maxStringLength)
+        {
+            return false;
+        }
+        length = length32;
+        // the generated writeTo takes the String4 only for the strings longer than 255 bytes
+        m_canonical = m_canonical && length > UINT8_MAX;
+    }
+    else
+    {
+        return false;
+    }
+    if (length > m_size - m_offset)
+    {
+        return false;
+    }
+    _value = std::string_view(m_data + m_offset, length);
+    m_offset += length;
+    return true;
+}
+
+bool WireReader::readBytes(WireHead const& _head, std::vector<tars::Char>& _value)
+{
+    bcos::bytesConstRef value;
+    if (!readBytes(_head, value))
+    {
+        return false;
+    }
+    _value.assign((const char*)value.data(), (const char*)value.data() + value.size());
+    return true;
+}
+
+bool WireReader::readBytes(WireHead const& _head, bcos::bytesConstRef& _value)
+{
+    size_t size;
+    // the element head is always of the tag 0 and the type Char
+    if (_head.type != WireType::SimpleList || m_offset >= m_size || m_data[m_offset++] != 0 ||
+        !readSize(size))
+    {
+        return false;
+    }
+    _value = bcos::bytesConstRef((const bcos::byte*)m_data + m_offset, size);
+    m_offset += size;
+    return true;
+}
+
+bool WireReader::readListSize(WireHead const& _head, size_t& _size)
+{
+    return _head.type == WireType::List && readSize(_size);
+}
+
+FieldState WireReader::findField(uint8_t _tag, WireHead& _head)
+{
+    if (eof())
+    {
+        return FieldState::Absent;
+    }
+    auto offset = m_offset;
+    if (!readHead(_head))
+    {
+        return FieldState::Unusual;
+    }
+    if (_head.type == WireType::StructEnd || _head.tag > _tag)
+    {
+        m_offset = offset;
+        return FieldState::Absent;
+    }
+    return _head.tag == _tag ? FieldState::Present : FieldState::Unusual;
+}
+
+bool WireReader::readStructEnd()
+{
+    WireHead head;
+    if (!readHead(head) || head.type != WireType::StructEnd)
+    {
+        return false;
+    }
+    m_canonical = m_canonical && head.tag == 0;
+    return true;
+}
+
+bool WireReader::skipField(WireHead const& _head)
+{
+    return skipField(_head, 0);
+}
+
+bool WireReader::skipField(WireHead const& _head, size_t _depth)
+{
+    auto skip = [this](size_t _bytes) {
+        if (_bytes > m_size - m_offset)
+        {
+            return false;
+        }
+        m_offset += _bytes;
+        return true;
+    };
+    switch (_head.type)
+    {
+    case WireType::Char:
+        return skip(1);
+    case WireType::Short:
+        return skip(2);
+    case WireType::Int32:
+    case WireType::Float:
+        return skip(4);
+    case WireType::Int64:
+    case WireType::Double:
+        return skip(8);
+    case WireType::String1:
+    {
+        uint8_t length;
+        return readBigEndian(length) && skip(length);
+    }
+    case WireType::String4:
+    {
+        uint32_t length;
+        return readBigEndian(length) && skip(length);
+    }
+    case WireType::SimpleList:
+    {
+        WireHead elementHead;
+        size_t size;
+        return readHead(elementHead) && elementHead.type == WireType::Char && readSize(size) &&
+               skip(size);
+    }
+    case WireType::List:
+    case WireType::Map:
+    {
+        size_t size;
+        if (_depth >= c_maxSkipDepth || !readSize(size))
+        {
+            return false;
+        }
+        auto fields = _head.type == WireType::Map ? 2 * size : size;
+        for (size_t i = 0; i < fields; ++i)
+        {
+            WireHead elementHead;
+            if (!readHead(elementHead) || !skipField(elementHead, _depth + 1))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    case WireType::StructBegin:
+    {
+        if (_depth >= c_maxSkipDepth)
+        {
+            return false;
+        }
+        WireHead fieldHead;
+        while (readHead(fieldHead))
+        {
+            if (fieldHead.type == WireType::StructEnd)
+            {
+                return true;
+            }
+            if (!skipField(fieldHead, _depth + 1))
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+    case WireType::StructEnd:
+    case WireType::ZeroTag:
+        return true;
+    default:
+        return false;
+    }
+}
+
+namespace
+{
+// the fields are read as the generated readFrom does: in its order, the absent optional fields
+// are left untouched, and the struct is reset by resetDefautlt before its fields are read
+// the generated writeTo leaves out the optional fields of the default values
+void checkOptional(WireReader& _reader, bool _required, bool _default)
+{
+    if (!_required && _default)
+    {
+        _reader.setNonCanonical();
+    }
+}
+
+template <typename Read>
+bool readField(WireReader& _reader, uint8_t _tag, bool _required, Read&& _read)
+{
+    WireHead head;
+    switch (_reader.findField(_tag, head))
+    {
+    case FieldState::Present:
+        return _read(head);
+    case FieldState::Absent:
+        return !_required;
+    default:
+        return false;
+    }
+}
+
+template <typename Int>
+bool readIntField(WireReader& _reader, uint8_t _tag, bool _required, Int& _value)
+{
+    static_assert(sizeof(Int) == sizeof(int32_t) || sizeof(Int) == sizeof(int64_t));
+    constexpr auto c_widest = sizeof(Int) == sizeof(int32_t) ? WireType::Int32 : WireType::Int64;
+    return readField(_reader, _tag, _required, [&](WireHead const& _head) {
+        int64_t value;
+        if (!_reader.readInt(_head, c_widest, value))
+        {
+            return false;
+        }
+        _value = (Int)value;
+        checkOptional(_reader, _required, value == 0);
+        return true;
+    });
+}
+
+// std::string or std::string_view
+template <typename String>
+bool readStringField(WireReader& _reader, uint8_t _tag, bool _required, String& _value)
+{
+    return readField(_reader, _tag, _required, [&](WireHead const& _head) {
+        if (!_reader.readString(_head, _value))
+        {
+            return false;
+        }
+        checkOptional(_reader, _required, _value.empty());
+        return true;
+    });
+}
+
+// std::vector<tars::Char> or bcos::bytesConstRef
+template <typename Bytes>
+bool readBytesField(WireReader& _reader, uint8_t _tag, bool _required, Bytes& _value)
+{
+    return readField(_reader, _tag, _required, [&](WireHead const& _head) {
+        if (!_reader.readBytes(_head, _value))
+        {
+            return false;
+        }
+        checkOptional(_reader, _required, _value.empty());
+        return true;
+    });
+}
+
+// the elements are read by _readElement from their heads of the tag 0
+template <typename Element, typename ReadElement>
+bool readListField(WireReader& _reader, uint8_t _tag, bool _required,
+    std::vector<Element>& _value, ReadElement&& _readElement)
+{
+    return readField(_reader, _tag, _required, [&](WireHead const& _head) {
+        size_t size;
+        if (!_reader.readListSize(_head, size))
+        {
+            return false;
+        }
+        checkOptional(_reader, _required, size == 0);
+        _value.resize(size);
+        for (auto& element : _value)
+        {
+            WireHead elementHead;
+            if (!_reader.readHead(elementHead) || elementHead.tag != 0 ||
+                !_readElement(elementHead, element))
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+// _readFields reads the fields of the nested struct, which must be followed by the struct end
+template <typename Struct, typename ReadFields>
+bool readStruct(
+    WireReader& _reader, WireHead const& _head, Struct& _value, ReadFields&& _readFields)
+{
+    if (_head.type != WireType::StructBegin)
+    {
+        return false;
+    }
+    _value.resetDefautlt();
+    return _readFields(_reader, _value) && _reader.readStructEnd();
+}
+
+template <typename Struct, typename ReadFields>
+bool readStructField(WireReader& _reader, uint8_t _tag, bool _required, Struct& _value,
+    ReadFields&& _readFields)
+{
+    // the generated writeTo writes the optional structs always
+    bool present = false;
+    auto read = readField(_reader, _tag, _required, [&](WireHead const& _head) {
+        present = true;
+        return readStruct(_reader, _head, _value, _readFields);
+    });
+    if (read && !present)
+    {
+        _reader.setNonCanonical();
+    }
+    return read;
+}
+
+// the data of the tag 1, _hashData refers to its encoded fields if they are encoded as the
+// generated writeTo does, and they are the preimage of the data hash then
+template <typename Struct, typename ReadFields>
+bool readDataField(WireReader& _reader, Struct& _data, ReadFields&& _readFields,
+    bcos::bytesConstRef& _hashData)
+{
+    _hashData = bcos::bytesConstRef();
+    auto canonical = _reader.canonical();
+    _reader.setCanonical(true);
+    auto read = readStructField(
+        _reader, 1, false, _data, [&](WireReader& _fieldReader, Struct& _value) {
+            auto begin = _fieldReader.offset();
+            if (!_readFields(_fieldReader, _value))
+            {
+                return false;
+            }
+            if (_fieldReader.canonical())
+            {
+                _hashData = bcos::bytesConstRef(
+                    (const bcos::byte*)_fieldReader.data() + begin, _fieldReader.offset() - begin);
+            }
+            return true;
+        });
+    _reader.setCanonical(canonical && _reader.canonical());
+    return read;
+}
+
+bool readTransactionPrecheckData(WireReader& _reader, TransactionPrecheck& _precheck)
+{
+    std::string_view nonce;
+    std::string_view to;
+    bcos::bytesConstRef input;
+    bcos::bytesConstRef nonceBytes;
+    if (!(readIntField(_reader, 1, true, _precheck.version) &&
+            readStringField(_reader, 2, true, _precheck.chainID) &&
+            readStringField(_reader, 3, true, _precheck.groupID) &&
+            readIntField(_reader, 4, true, _precheck.blockLimit) &&
+            readStringField(_reader, 5, true, nonce) && readStringField(_reader, 6, false, to) &&
+            readBytesField(_reader, 7, true, input) &&
+            readBytesField(_reader, 8, false, nonceBytes)))
+    {
+        return false;
+    }
+    try
+    {
+        _precheck.nonce = decodeTransactionNonce(nonceBytes, nonce);
+    }
+    catch (std::exception const&)
+    {
+        return false;
+    }
+    return true;
+}
+
+bool readTransactionData(WireReader& _reader, bcostars::TransactionData& _data)
+{
+    return readIntField(_reader, 1, true, _data.version) &&
+           readStringField(_reader, 2, true, _data.chainID) &&
+           readStringField(_reader, 3, true, _data.groupID) &&
+           readIntField(_reader, 4, true, _data.blockLimit) &&
+           readStringField(_reader, 5, true, _data.nonce) &&
+           readStringField(_reader, 6, false, _data.to) &&
+           readBytesField(_reader, 7, true, _data.input) &&
+           readBytesField(_reader, 8, false, _data.nonceBytes);
+}
+
+// the order the generated code reads and writes the fields of Transaction, in which the sender
+// of the tag 7 is declared before the importTime of the tag 4
+std::vector<uint8_t> const& transactionFieldOrder()
+{
+    static std::vector<uint8_t> const s_order = []() {
+        bcostars::Transaction probe;
+        probe.dataHash.assign(1, 'h');
+        probe.signature.assign(1, 's');
+        probe.sender.assign(1, 'f');
+        probe.importTime = 1;
+        probe.attribute = 1;
+        probe.source = "s";
+        tars::TarsOutputStream<tars::BufferWriterVector> output;
+        probe.writeTo(output);
+        std::vector<tars::Char> buffer;
+        output.swap(buffer);
+
+        std::vector<uint8_t> order;
+        WireReader reader(buffer.data(), buffer.size());
+        WireHead head;
+        while (!reader.eof() && reader.readHead(head) && reader.skipField(head))
+        {
+            order.push_back(head.tag);
+        }
+        // the hand-written path is disabled if the layout is not the expected one
+        auto sorted = order;
+        std::sort(sorted.begin(), sorted.end());
+        if (sorted != std::vector<uint8_t>{1, 2, 3, 4, 5, 6, 7})
+        {
+            order.clear();
+        }
+        return order;
+    }();
+    return s_order;
+}
+
+bool readTransactionFields(
+    WireReader& _reader, bcostars::Transaction& _transaction, bcos::bytesConstRef& _hashData)
+{
+    auto const& order = transactionFieldOrder();
+    if (order.empty())
+    {
+        return false;
+    }
+    for (auto tag : order)
+    {
+        bool read = false;
+        switch (tag)
+        {
+        case 1:
+            read = readDataField(_reader, _transaction.data, readTransactionData, _hashData);
+            break;
+        case 2:
+            read = readBytesField(_reader, 2, false, _transaction.dataHash);
+            break;
+        case 3:
+            read = readBytesField(_reader, 3, false, _transaction.signature);
+            break;
+        case 4:
+            read = readIntField(_reader, 4, false, _transaction.importTime);
+            break;
+        case 5:
+            read = readIntField(_reader, 5, false, _transaction.attribute);
+            break;
+        case 6:
+            read = readStringField(_reader, 6, false, _transaction.source);
+            break;
+        case 7:
+            read = readBytesField(_reader, 7, false, _transaction.sender);
+            break;
+        }
+        if (!read)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool readLogEntry(WireReader& _reader, bcostars::LogEntry& _logEntry)
+{
+    return readStringField(_reader, 1, false, _logEntry.address) &&
+           readListField(_reader, 2, false, _logEntry.topic,
+               [&](WireHead const& _head, std::vector<tars::Char>& _topic) {
+                   return _reader.readBytes(_head, _topic);
+               }) &&
+           readBytesField(_reader, 3, false, _logEntry.data);
+}
+
+bool readTransactionReceiptData(WireReader& _reader, bcostars::TransactionReceiptData& _data)
+{
+    return readIntField(_reader, 1, true, _data.version) &&
+           readStringField(_reader, 2, true, _data.gasUsed) &&
+           readStringField(_reader, 3, false, _data.contractAddress) &&
+           readIntField(_reader, 4, true, _data.status) &&
+           readBytesField(_reader, 5, false, _data.output) &&
+           readListField(_reader, 6, false, _data.logEntries,
+               [&](WireHead const& _head, bcostars::LogEntry& _logEntry) {
+                   return readStruct(_reader, _head, _logEntry, readLogEntry);
+               }) &&
+           readIntField(_reader, 7, true, _data.blockNumber);
+}
+
+bool readTransactionReceiptFields(WireReader& _reader, bcostars::TransactionReceipt& _receipt,
+    bcos::bytesConstRef& _hashData)
+{
+    return readDataField(_reader, _receipt.data, readTransactionReceiptData, _hashData) &&
+           readBytesField(_reader, 2, false, _receipt.dataHash);
+}
+
+bool readParentInfo(WireReader& _reader, bcostars::ParentInfo& _parentInfo)
+{
+    return readIntField(_reader, 1, true, _parentInfo.blockNumber) &&
+           readBytesField(_reader, 2, true, _parentInfo.blockHash);
+}
+
+bool readSignature(WireReader& _reader, bcostars::Signature& _signature)
+{
+    return readIntField(_reader, 1, true, _signature.sealerIndex) &&
+           readBytesField(_reader, 2, true, _signature.signature);
+}
+
+bool readBlockHeaderData(WireReader& _reader, bcostars::BlockHeaderData& _data)
+{
+    return readIntField(_reader, 2, true, _data.version) &&
+           readListField(_reader, 3, true, _data.parentInfo,
+               [&](WireHead const& _head, bcostars::ParentInfo& _parentInfo) {
+                   return readStruct(_reader, _head, _parentInfo, readParentInfo);
+               }) &&
+           readBytesField(_reader, 4, true, _data.txsRoot) &&
+           readBytesField(_reader, 5, true, _data.receiptRoot) &&
+           readBytesField(_reader, 6, true, _data.stateRoot) &&
+           readIntField(_reader, 7, true, _data.blockNumber) &&
+           readStringField(_reader, 8, true, _data.gasUsed) &&
+           readIntField(_reader, 9, true, _data.timestamp) &&
+           readIntField(_reader, 10, true, _data.sealer) &&
+           readListField(_reader, 11, true, _data.sealerList,
+               [&](WireHead const& _head, std::vector<tars::Char>& _sealer) {
+                   return _reader.readBytes(_head, _sealer);
+               }) &&
+           readBytesField(_reader, 12, true, _data.extraData) &&
+           readListField(_reader, 13, true, _data.consensusWeights,
+               [&](WireHead const& _head, tars::Int64& _weight) {
+                   int64_t weight;
+                   if (!_reader.readInt(_head, WireType::Int64, weight))
+                   {
+                       return false;
+                   }
+                   _weight = weight;
+                   return true;
+               });
+}
+
+bool readBlockHeaderFields(
+    WireReader& _reader, bcostars::BlockHeader& _blockHeader, bcos::bytesConstRef& _hashData)
+{
+    return readDataField(_reader, _blockHeader.data, readBlockHeaderData, _hashData) &&
+           readBytesField(_reader, 2, false, _blockHeader.dataHash) &&
+           readListField(_reader, 3, false, _blockHeader.signatureList,
+               [&](WireHead const& _head, bcostars::Signature& _signature) {
+                   return readStruct(_reader, _head, _signature, readSignature);
+               });
+}
+
+// the top level struct has no struct head, and the data after its fields is not read, as the
+// generated readFrom does
+template <typename Struct, typename ReadFields>
+bool tryRead(bcos::bytesConstRef _data, Struct& _value, ReadFields&& _readFields,
+    bcos::bytesConstRef& _hashData)
+{
+    WireReader reader((const char*)_data.data(), _data.size());
+    _value.resetDefautlt();
+    return _readFields(reader, _value, _hashData);
+}
+
+template <typename Struct, typename ReadFields>
+void readOrFallback(bcos::bytesConstRef _data, Struct& _value, ReadFields&& _readFields,
+    bcos::bytesConstRef& _hashData)
+{
+    if (tryRead(_data, _value, _readFields, _hashData))
+    {
+        return;
+    }
+    _hashData = bcos::bytesConstRef();
+    // the fields read by hand are the same as read by the generated code, which reads them again
+    tars::TarsInputStream<tars::BufferReader> input;
+    input.setBuffer((const char*)_data.data(), _data.size());
+    _value.readFrom(input);
+}
+}  // namespace
+
+void bcostars::protocol::readTransaction(
+    bcos::bytesConstRef _data, bcostars::Transaction& _transaction)
+{
+    bcos::bytesConstRef hashData;
+    readOrFallback(_data, _transaction, readTransactionFields, hashData);
+}
+
+void bcostars::protocol::readTransactionReceipt(
+    bcos::bytesConstRef _data, bcostars::TransactionReceipt& _receipt)
+{
+    bcos::bytesConstRef hashData;
+    readOrFallback(_data, _receipt, readTransactionReceiptFields, hashData);
+}
+
+void bcostars::protocol::readBlockHeader(
+    bcos::bytesConstRef _data, bcostars::BlockHeader& _blockHeader)
+{
+    bcos::bytesConstRef hashData;
+    readOrFallback(_data, _blockHeader, readBlockHeaderFields, hashData);
+}
+
+void bcostars::protocol::readTransactionWithHashData(bcos::bytesConstRef _data,
+    bcostars::Transaction& _transaction, bcos::bytesConstRef& _hashData)
+{
+    readOrFallback(_data, _transaction, readTransactionFields, _hashData);
+}
+
+void bcostars::protocol::readTransactionReceiptWithHashData(bcos::bytesConstRef _data,
+    bcostars::TransactionReceipt& _receipt, bcos::bytesConstRef& _hashData)
+{
+    readOrFallback(_data, _receipt, readTransactionReceiptFields, _hashData);
+}
+
+void bcostars::protocol::readBlockHeaderWithHashData(bcos::bytesConstRef _data,
+    bcostars::BlockHeader& _blockHeader, bcos::bytesConstRef& _hashData)
+{
+    readOrFallback(_data, _blockHeader, readBlockHeaderFields, _hashData);
+}
+
+bool bcostars::protocol::tryReadTransaction(
+    bcos::bytesConstRef _data, bcostars::Transaction& _transaction)
+{
+    bcos::bytesConstRef hashData;
+    return tryRead(_data, _transaction, readTransactionFields, hashData);
+}
+
+bool bcostars::protocol::tryReadTransactionReceipt(
+    bcos::bytesConstRef _data, bcostars::TransactionReceipt& _receipt)
+{
+    bcos::bytesConstRef hashData;
+    return tryRead(_data, _receipt, readTransactionReceiptFields, hashData);
+}
+
+bool bcostars::protocol::tryReadBlockHeader(
+    bcos::bytesConstRef _data, bcostars::BlockHeader& _blockHeader)
+{
+    bcos::bytesConstRef hashData;
+    return tryRead(_data, _blockHeader, readBlockHeaderFields, hashData);
+}
+
+bool bcostars::protocol::readTransactionPrecheck(
+    bcos::bytesConstRef _data, TransactionPrecheck& _precheck)
+{
+    WireReader reader((const char*)_data.data(), _data.size());
+    WireHead head;
+    // the data is the first field written by the generated writeTo, then the data hash
+    if (reader.findField(1, head) != FieldState::Present || head.type != WireType::StructBegin)
+    {
+        return false;
+    }
+    auto begin = reader.offset();
+    if (!readTransactionPrecheckData(reader, _precheck))
+    {
+        return false;
+    }
+    auto end = reader.offset();
+    // the preimage of the hash is the data alone
+    _precheck.canonical = reader.canonical();
+    _precheck.dataHash = bcos::bytesConstRef();
+    if (!reader.readStructEnd() || !readBytesField(reader, 2, false, _precheck.dataHash))
+    {
+        return false;
+    }
+    _precheck.data = bcos::bytesConstRef(_data.data() + begin, end - begin);
+    return true;
+}
@@ -0,0 +1,166 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the hand-written readers of the hot tars structs
+ * @file WireCodec.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/tars/Block.h"
+#include "bcos-tars-protocol/tars/Transaction.h"
+#include "bcos-tars-protocol/tars/TransactionReceipt.h"
+#include <bcos-framework/interfaces/crypto/CommonType.h>
+#include <bcos-framework/libutilities/Common.h>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bcostars
+{
+namespace protocol
+{
+// the head types of the tars encoding
+enum class WireType : uint8_t
+{
+    Char = 0,
+    Short = 1,
+    Int32 = 2,
+    Int64 = 3,
+    Float = 4,
+    Double = 5,
+    String1 = 6,
+    String4 = 7,
+    Map = 8,
+    List = 9,
+    StructBegin = 10,
+    StructEnd = 11,
+    ZeroTag = 12,
+    SimpleList = 13
+};
+
+struct WireHead
+{
+    uint8_t tag = 0;
+    WireType type = WireType::ZeroTag;
+};
+
+enum class FieldState
+{
+    Present,
+    Absent,
+    // the generated readFrom has to deal with it, e.g. by skipping the unknown fields
+    Unusual
+};
+
+// reads the tars encoding in place, every method returns false instead of throwing on the data
+// it does not expect, and the offset is unspecified then; it also checks whether the data is
+// encoded as the generated writeTo does, i.e. with the narrowest integers, the shortest heads and
+// lengths, while the optional fields of the default values are checked by the callers
+class WireReader
+{
+public:
+    WireReader(const char* _data, size_t _size) : m_data(_data), m_size(_size) {}
+
+    bool eof() const { return m_offset >= m_size; }
+    size_t offset() const { return m_offset; }
+    void seek(size_t _offset) { m_offset = _offset; }
+    const char* data() const { return m_data; }
+    // whether all read so far is encoded as the generated writeTo does
+    bool canonical() const { return m_canonical; }
+    void setNonCanonical() { m_canonical = false; }
+    void setCanonical(bool _canonical) { m_canonical = _canonical; }
+
+    bool readHead(WireHead& _head);
+    // skips the value after _head, including the nested lists, maps and structs
+    bool skipField(WireHead const& _head);
+    // the head of the field _tag, which must be the next field as in the layout of the generated
+    // writeTo, the field is absent if a greater tag, the struct end or the end of data is met
+    FieldState findField(uint8_t _tag, WireHead& _head);
+    // the struct end must follow the last known field
+    bool readStructEnd();
+
+    // the integers up to _widest, e.g. the Int64 is not read into a tars::Int32
+    bool readInt(WireHead const& _head, WireType _widest, int64_t& _value);
+    bool readString(WireHead const& _head, std::string& _value);
+    bool readBytes(WireHead const& _head, std::vector<tars::Char>& _value);
+    // in place, without copying
+    bool readString(WireHead const& _head, std::string_view& _value);
+    bool readBytes(WireHead const& _head, bcos::bytesConstRef& _value);
+    // the element count of the list, the element heads are of the tag 0
+    bool readListSize(WireHead const& _head, size_t& _size);
+
+private:
+    bool skipField(WireHead const& _head, size_t _depth);
+    bool readSize(size_t& _size);
+    template <typename Int>
+    bool readBigEndian(Int& _value);
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_offset = 0;
+    bool m_canonical = true;
+};
+
+// decodes the struct as the generated readFrom does, the layout written by the generated writeTo
+// of the known versions is read by hand, and the others, e.g. the unknown fields of the newer
+// versions or the malformed data, fall back to the generated readFrom, so the results and the
+// exceptions are the same
+void readTransaction(bcos::bytesConstRef _data, bcostars::Transaction& _transaction);
+void readTransactionReceipt(bcos::bytesConstRef _data, bcostars::TransactionReceipt& _receipt);
+void readBlockHeader(bcos::bytesConstRef _data, bcostars::BlockHeader& _blockHeader);
+
+// as above, and _hashData refers to the encoded fields of the data in _data, i.e. the preimage
+// of the data hash, if they are read by hand and encoded as the generated writeTo does, otherwise
+// it is empty and the preimage must be written by writeTo
+void readTransactionWithHashData(bcos::bytesConstRef _data, bcostars::Transaction& _transaction,
+    bcos::bytesConstRef& _hashData);
+void readTransactionReceiptWithHashData(bcos::bytesConstRef _data,
+    bcostars::TransactionReceipt& _receipt, bcos::bytesConstRef& _hashData);
+void readBlockHeaderWithHashData(bcos::bytesConstRef _data, bcostars::BlockHeader& _blockHeader,
+    bcos::bytesConstRef& _hashData);
+
+// the hand-written paths alone, false if the generated readFrom must be used, and the struct is
+// unspecified then
+bool tryReadTransaction(bcos::bytesConstRef _data, bcostars::Transaction& _transaction);
+bool tryReadTransactionReceipt(bcos::bytesConstRef _data, bcostars::TransactionReceipt& _receipt);
+bool tryReadBlockHeader(bcos::bytesConstRef _data, bcostars::BlockHeader& _blockHeader);
+
+// the fields of the encoded transaction the admission checks of the txpool need, the views refer
+// to the encoded transaction
+struct TransactionPrecheck
+{
+    int32_t version = 0;
+    std::string_view chainID;
+    std::string_view groupID;
+    int64_t blockLimit = 0;
+    bcos::u256 nonce;
+    // the encoded TransactionData, which is the preimage of the hash if canonical
+    bcos::bytesConstRef data;
+    // the hash carried by the transaction, usually empty
+    bcos::bytesConstRef dataHash;
+    // the data is encoded as the generated writeTo does
+    bool canonical = false;
+    // calculated by TransactionFactoryImpl::precheckTransaction
+    bcos::crypto::HashType hash;
+};
+
+// reads the data and the data hash of the transaction by hand without copying the input, and
+// leaves the fields after them, so the full decode may still fail; false if the layout is not the
+// known one or the nonce is malformed, then the transaction must be decoded fully
+bool readTransactionPrecheck(bcos::bytesConstRef _data, TransactionPrecheck& _precheck);
+}  // namespace protocol
+}  // namespace bcostars
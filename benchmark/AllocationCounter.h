@@ -0,0 +1,74 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief count the heap allocations of the benchmark process
+ * @file AllocationCounter.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/AllocationTracker.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+namespace bcostars
+{
+namespace bench
+{
+// the benchmarks are built with ALLOCATION_TRACKING, so the library counts the allocations
+static_assert(bcostars::allocationTrackingEnabled(),
+    "the benchmarks require the library built with ALLOCATION_TRACKING");
+
+// accumulates the allocations between start and stop, so the set-up of the benchmark
+// iterations done with the timing paused can be excluded as well
+class AllocationMeter
+{
+public:
+    void start() { m_begin = allocationTotals(); }
+    void stop()
+    {
+        auto end = allocationTotals();
+        m_total.count += end.count - m_begin.count;
+        m_total.bytes += end.bytes - m_begin.bytes;
+    }
+
+    // the benchmark fails if more allocations per iteration are measured
+    void setBudget(double _allocationsPerOp) { m_budget = _allocationsPerOp; }
+
+    // reports allocs/op and allocBytes/op of the measured allocations
+    void report(benchmark::State& _state) const
+    {
+        _state.counters["allocs/op"] = benchmark::Counter(
+            (double)m_total.count, benchmark::Counter::kAvgIterations);
+        _state.counters["allocBytes/op"] = benchmark::Counter(
+            (double)m_total.bytes, benchmark::Counter::kAvgIterations);
+        auto iterations = (double)std::max<benchmark::IterationCount>(_state.iterations(), 1);
+        if (m_budget >= 0 && (double)m_total.count / iterations > m_budget)
+        {
+            _state.SkipWithError(("over the allocation budget of " + std::to_string(m_budget) +
+                                  " allocs/op")
+                                     .c_str());
+        }
+    }
+
+private:
+    AllocationCounts m_begin;
+    AllocationCounts m_total;
+    double m_budget = -1;
+};
+}  // namespace bench
+}  // namespace bcostars
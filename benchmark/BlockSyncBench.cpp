@@ -0,0 +1,124 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief benchmark the block sync catch-up throughput against a local ledger servant
+ * @file BlockSyncBench.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "mock/LocalServiceClients.h"
+#include <benchmark/benchmark.h>
+#include <future>
+#include <mutex>
+
+using namespace bcostars;
+using namespace bcostars::bench;
+
+namespace
+{
+constexpr int64_t c_syncBlocks = 10000;
+
+// fetch the blocks one by one with _window requests in flight
+int64_t syncByNumber(LedgerServiceClient& _client, int64_t _blocks, int64_t _window)
+{
+    // Note: shared with the callbacks, which may still be running when the sync finishes
+    struct SyncState : public std::enable_shared_from_this<SyncState>
+    {
+        LedgerServiceClient* client;
+        int64_t blocks;
+        int64_t window;
+        std::mutex mutex;
+        std::promise<void> finished;
+        int64_t nextNumber = 0;
+        int64_t inflight = 0;
+        int64_t fetched = 0;
+        bool failed = false;
+
+        // Note: must be called with the mutex locked
+        void fetchMore()
+        {
+            while (!failed && nextNumber < blocks && inflight < window)
+            {
+                inflight++;
+                client->asyncGetBlockDataByNumber(nextNumber++, 0,
+                    [self = shared_from_this()](
+                        bcos::Error::Ptr _error, bcos::protocol::Block::Ptr _block) {
+                        benchmark::DoNotOptimize(_block);
+                        std::lock_guard<std::mutex> lock(self->mutex);
+                        self->inflight--;
+                        self->failed = self->failed || _error;
+                        self->fetched += _error ? 0 : 1;
+                        self->fetchMore();
+                        if (self->inflight == 0)
+                        {
+                            self->finished.set_value();
+                        }
+                    });
+            }
+        }
+    };
+    auto state = std::make_shared<SyncState>();
+    state->client = &_client;
+    state->blocks = _blocks;
+    state->window = _window;
+    auto finished = state->finished.get_future();
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->fetchMore();
+    }
+    finished.wait();
+    std::lock_guard<std::mutex> lock(state->mutex);
+    return state->fetched;
+}
+}  // namespace
+
+static void BM_syncByNumber(benchmark::State& _state)
+{
+    auto client = localLedgerClient();
+    int64_t blocks = 0;
+    for (auto _ : _state)
+    {
+        blocks += syncByNumber(*client, c_syncBlocks, _state.range(0));
+    }
+    _state.counters["blocks"] = benchmark::Counter(blocks, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_syncByNumber)->Arg(1)->Arg(4)->Arg(16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_syncByRange(benchmark::State& _state)
+{
+    auto client = localLedgerClient();
+    int64_t blocks = 0;
+    for (auto _ : _state)
+    {
+        std::promise<int64_t> finished;
+        client->asyncGetBlockDataByRange(
+            0, c_syncBlocks, 0,
+            [](std::shared_ptr<LedgerServiceClient::BlockList> _blocks) {
+                benchmark::DoNotOptimize(_blocks);
+            },
+            [&finished](bcos::Error::Ptr, int64_t _fetchedCount) {
+                finished.set_value(_fetchedCount);
+            },
+            _state.range(0), _state.range(1));
+        blocks += finished.get_future().get();
+    }
+    _state.counters["blocks"] = benchmark::Counter(blocks, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_syncByRange)
+    ->Args({16, 4})
+    ->Args({64, 4})
+    ->Args({256, 2})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
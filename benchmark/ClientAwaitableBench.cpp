@@ -0,0 +1,111 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief benchmark the per call overhead of the callbacks and the coroutines
+ * @file ClientAwaitableBench.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "bcos-tars-protocol/client/ClientAwaitable.h"
+#include "mock/LocalServiceClients.h"
+#include <benchmark/benchmark.h>
+#include <future>
+
+#ifdef BCOS_TARS_COROUTINE
+using namespace bcostars;
+using namespace bcostars::bench;
+
+namespace
+{
+// the ledger client answering asyncGetBlockHashByNumber(0) from the cache
+std::shared_ptr<LedgerServiceClient> cachedLedgerClient()
+{
+    auto client = localLedgerClient();
+    client->setImmutableCacheCapacity(1024 * 1024, 0);
+    std::promise<void> cached;
+    client->asyncGetBlockHashByNumber(
+        0, [&cached](bcos::Error::Ptr, bcos::crypto::HashType) { cached.set_value(); });
+    cached.get_future().wait();
+    return client;
+}
+
+DetachedClientTask getCachedBlockHashes(LedgerServiceClient& _client, benchmark::State& _state)
+{
+    for (auto _ : _state)
+    {
+        auto [error, blockHash] =
+            co_await callAsync(_client, &LedgerServiceClient::asyncGetBlockHashByNumber, 0);
+        benchmark::DoNotOptimize(blockHash);
+    }
+}
+
+DetachedClientTask getBlockNumber(LedgerServiceClient& _client, std::promise<void>& _finished)
+{
+    auto [error, blockNumber] =
+        co_await callAsync(_client, &LedgerServiceClient::asyncGetBlockNumber);
+    benchmark::DoNotOptimize(blockNumber);
+    _finished.set_value();
+}
+}  // namespace
+
+// the responses are answered by the cache synchronously, so only the adaption is measured
+static void BM_cachedCallWithCallback(benchmark::State& _state)
+{
+    auto client = cachedLedgerClient();
+    for (auto _ : _state)
+    {
+        client->asyncGetBlockHashByNumber(0, [](bcos::Error::Ptr, bcos::crypto::HashType _hash) {
+            benchmark::DoNotOptimize(_hash);
+        });
+    }
+}
+BENCHMARK(BM_cachedCallWithCallback);
+
+static void BM_cachedCallWithCoroutine(benchmark::State& _state)
+{
+    auto client = cachedLedgerClient();
+    getCachedBlockHashes(*client, _state);
+}
+BENCHMARK(BM_cachedCallWithCoroutine);
+
+static void BM_remoteCallWithCallback(benchmark::State& _state)
+{
+    auto client = localLedgerClient();
+    for (auto _ : _state)
+    {
+        std::promise<void> finished;
+        client->asyncGetBlockNumber(
+            [&finished](bcos::Error::Ptr, bcos::protocol::BlockNumber _blockNumber) {
+                benchmark::DoNotOptimize(_blockNumber);
+                finished.set_value();
+            });
+        finished.get_future().wait();
+    }
+}
+BENCHMARK(BM_remoteCallWithCallback)->UseRealTime();
+
+// a coroutine frame is allocated for every call
+static void BM_remoteCallWithCoroutine(benchmark::State& _state)
+{
+    auto client = localLedgerClient();
+    for (auto _ : _state)
+    {
+        std::promise<void> finished;
+        getBlockNumber(*client, finished);
+        finished.get_future().wait();
+    }
+}
+BENCHMARK(BM_remoteCallWithCoroutine)->UseRealTime();
+#endif
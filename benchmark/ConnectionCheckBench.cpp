@@ -0,0 +1,72 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief benchmark the connection check on the message sending path
+ * @file ConnectionCheckBench.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "bcos-tars-protocol/Common.h"
+#include "bcos-tars-protocol/client/ConnectionStatus.h"
+#include "bcos-tars-protocol/tars/GatewayService.h"
+#include <benchmark/benchmark.h>
+#include <tarscpp/servant/Communicator.h>
+
+using namespace bcostars;
+
+namespace
+{
+// the proxy to three endpoints, the connection check only inspects the configured endpoints
+bcostars::GatewayServicePrx gatewayProxy()
+{
+    static tars::CommunicatorPtr s_communicator = new tars::Communicator();
+    static bcostars::GatewayServicePrx s_proxy =
+        s_communicator->stringToProxy<bcostars::GatewayServicePrx>(
+            "bcos.bench.GatewayServiceObj@tcp -h 127.0.0.1 -p 20200:tcp -h 127.0.0.1 -p "
+            "20201:tcp -h 127.0.0.1 -p 20202");
+    return s_proxy;
+}
+
+std::function<void(bcos::Error::Ptr)> const c_errorCallback = [](bcos::Error::Ptr _error) {
+    benchmark::DoNotOptimize(_error);
+};
+}  // namespace
+
+// before: every message copies all the endpoints of the proxy
+static void BM_checkConnectionByEndpoints(benchmark::State& _state)
+{
+    auto proxy = gatewayProxy();
+    for (auto _ : _state)
+    {
+        benchmark::DoNotOptimize(
+            checkConnection("GatewayServiceClient", "asyncSendMessageByNodeID", proxy,
+                c_errorCallback));
+    }
+}
+BENCHMARK(BM_checkConnectionByEndpoints)->ThreadRange(1, 8);
+
+// after: every message loads the cached connection state
+static void BM_checkConnectionCached(benchmark::State& _state)
+{
+    static auto s_connection = ConnectionStatus::create(gatewayProxy());
+    s_connection->refresh();
+    for (auto _ : _state)
+    {
+        benchmark::DoNotOptimize(
+            s_connection->check("GatewayServiceClient", "asyncSendMessageByNodeID",
+                c_errorCallback));
+    }
+}
+BENCHMARK(BM_checkConnectionCached)->ThreadRange(1, 8);
@@ -0,0 +1,83 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief benchmark the tars transport against the in-process transport
+ * @file InProcessTransportBench.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "bcos-tars-protocol/client/LocalServiceRegistry.h"
+#include "mock/MockLedger.h"
+#include <benchmark/benchmark.h>
+#include <future>
+
+using namespace bcostars;
+using namespace bcostars::bench;
+
+namespace
+{
+bcos::ledger::LedgerInterface::Ptr ledgerOf(ServiceTransport _transport)
+{
+    static auto s_mockLedger = std::make_shared<MockLedger>();
+    if (_transport == ServiceTransport::InProcess)
+    {
+        LocalServiceRegistry::instance().registerService<bcos::ledger::LedgerInterface>(
+            s_mockLedger);
+    }
+    return createServiceClient<bcos::ledger::LedgerInterface>(
+        _transport, []() { return localLedgerClient(); });
+}
+}  // namespace
+
+static void BM_getBlockNumber(benchmark::State& _state)
+{
+    auto ledger = ledgerOf((ServiceTransport)_state.range(0));
+    for (auto _ : _state)
+    {
+        std::promise<void> finished;
+        ledger->asyncGetBlockNumber(
+            [&finished](bcos::Error::Ptr, bcos::protocol::BlockNumber _blockNumber) {
+                benchmark::DoNotOptimize(_blockNumber);
+                finished.set_value();
+            });
+        finished.get_future().wait();
+    }
+}
+BENCHMARK(BM_getBlockNumber)
+    ->ArgName("inProcess")
+    ->Arg((int64_t)ServiceTransport::Tars)
+    ->Arg((int64_t)ServiceTransport::InProcess)
+    ->UseRealTime();
+
+// the tars transport encodes and decodes the whole block, the in-process one passes the pointer
+static void BM_getBlockData(benchmark::State& _state)
+{
+    auto ledger = ledgerOf((ServiceTransport)_state.range(0));
+    for (auto _ : _state)
+    {
+        std::promise<void> finished;
+        ledger->asyncGetBlockDataByNumber(
+            1, 0, [&finished](bcos::Error::Ptr, bcos::protocol::Block::Ptr _block) {
+                benchmark::DoNotOptimize(_block);
+                finished.set_value();
+            });
+        finished.get_future().wait();
+    }
+}
+BENCHMARK(BM_getBlockData)
+    ->ArgName("inProcess")
+    ->Arg((int64_t)ServiceTransport::Tars)
+    ->Arg((int64_t)ServiceTransport::InProcess)
+    ->UseRealTime();
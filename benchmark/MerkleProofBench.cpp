@@ -0,0 +1,163 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief benchmark the batch transaction queries with the different proof responses
+ * @file MerkleProofBench.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "mock/LocalServiceClients.h"
+#include <benchmark/benchmark.h>
+#include <future>
+
+using namespace bcostars;
+using namespace bcostars::bench;
+
+namespace
+{
+bcos::crypto::HashListPtr makeTxHashList(size_t _size)
+{
+    auto txHashList = std::make_shared<bcos::crypto::HashList>();
+    for (size_t i = 0; i < _size; ++i)
+    {
+        bcos::crypto::HashType txHash;
+        std::copy_n((bcos::byte const*)&i, sizeof(i), txHash.data());
+        txHashList->emplace_back(txHash);
+    }
+    return txHashList;
+}
+
+template <typename T>
+size_t encodedSize(T const& _value)
+{
+    tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
+    _value.writeTo(output);
+    return output.getByteBuffer().size();
+}
+
+// the encoded sizes of the hex string and the binary forms of the mock proof
+std::pair<size_t, size_t> proofEncodedSizes()
+{
+    bcos::ledger::MerkleProof proof;
+    size_t hexSize = 0;
+    for (size_t level = 0; level < MockLedgerService::config().proofLevels; ++level)
+    {
+        bcostars::MerkleProofItem item;
+        item.left.push_back(bcos::toHex(bcos::bytes(32, (bcos::byte)level)));
+        hexSize += encodedSize(item);
+        proof.emplace_back(item.left, item.right);
+    }
+    return {hexSize, encodedSize(bcostars::protocol::MerkleProofView::encode(proof))};
+}
+}  // namespace
+
+static void BM_batchTxsWithHexProof(benchmark::State& _state)
+{
+    auto client = localLedgerClient();
+    auto txHashList = makeTxHashList(_state.range(0));
+    size_t siblings = 0;
+    for (auto _ : _state)
+    {
+        std::promise<size_t> finished;
+        client->asyncGetBatchTxsByHashList(txHashList, true,
+            [&finished](bcos::Error::Ptr _error, bcos::protocol::TransactionsPtr,
+                std::shared_ptr<std::map<std::string, bcos::ledger::MerkleProofPtr>> _proofs) {
+                if (_error)
+                {
+                    finished.set_value(0);
+                    return;
+                }
+                size_t count = 0;
+                for (auto const& it : *_proofs)
+                {
+                    for (auto const& level : *it.second)
+                    {
+                        count += level.first.size() + level.second.size();
+                    }
+                }
+                finished.set_value(count);
+            });
+        siblings += finished.get_future().get();
+    }
+    _state.counters["siblings"] = benchmark::Counter(siblings, benchmark::Counter::kIsRate);
+    _state.counters["proofBytes"] = proofEncodedSizes().first;
+}
+BENCHMARK(BM_batchTxsWithHexProof)->Arg(16)->Arg(256)->Arg(1024)->UseRealTime();
+
+static void BM_batchTxsWithBinaryProof(benchmark::State& _state)
+{
+    auto client = localLedgerClient();
+    auto txHashList = makeTxHashList(_state.range(0));
+    size_t siblings = 0;
+    for (auto _ : _state)
+    {
+        std::promise<size_t> finished;
+        client->asyncGetBatchTxsWithBinaryProof(
+            txHashList, [&finished](bcos::Error::Ptr _error, bcos::protocol::TransactionsPtr,
+                            std::shared_ptr<LedgerServiceClient::MerkleProofViewMap> _proofs) {
+                if (_error)
+                {
+                    finished.set_value(0);
+                    return;
+                }
+                size_t count = 0;
+                for (auto const& it : *_proofs)
+                {
+                    for (size_t level = 0; level < it.second->levels(); ++level)
+                    {
+                        count += it.second->leftSize(level) + it.second->rightSize(level);
+                    }
+                }
+                finished.set_value(count);
+            });
+        siblings += finished.get_future().get();
+    }
+    _state.counters["siblings"] = benchmark::Counter(siblings, benchmark::Counter::kIsRate);
+    _state.counters["proofBytes"] = proofEncodedSizes().second;
+}
+BENCHMARK(BM_batchTxsWithBinaryProof)->Arg(16)->Arg(256)->Arg(1024)->UseRealTime();
+
+static void BM_batchTxsAligned(benchmark::State& _state)
+{
+    auto client = localLedgerClient();
+    auto txHashList = makeTxHashList(_state.range(0));
+    size_t siblings = 0;
+    for (auto _ : _state)
+    {
+        std::promise<size_t> finished;
+        client->asyncGetBatchTxsAligned(txHashList, true,
+            [&finished](bcos::Error::Ptr _error, bcos::protocol::TransactionsPtr,
+                std::shared_ptr<LedgerServiceClient::MerkleProofViewList> _proofs) {
+                if (_error)
+                {
+                    finished.set_value(0);
+                    return;
+                }
+                size_t count = 0;
+                for (auto const& proof : *_proofs)
+                {
+                    for (size_t level = 0; proof && level < proof->levels(); ++level)
+                    {
+                        count += proof->leftSize(level) + proof->rightSize(level);
+                    }
+                }
+                finished.set_value(count);
+            });
+        siblings += finished.get_future().get();
+    }
+    _state.counters["siblings"] = benchmark::Counter(siblings, benchmark::Counter::kIsRate);
+    _state.counters["proofBytes"] = proofEncodedSizes().second;
+}
+BENCHMARK(BM_batchTxsAligned)->Arg(16)->Arg(256)->Arg(1024)->UseRealTime();
@@ -0,0 +1,719 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief benchmark encoding, decoding, hashing and verifying the protocol objects
+ * @file ProtocolCodecBench.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "AllocationCounter.h"
+#include "bcos-tars-protocol/protocol/BlockFactoryImpl.h"
+#include "bcos-tars-protocol/protocol/BlockImpl.h"
+#include "bcos-tars-protocol/protocol/DecimalCodec.h"
+#include "bcos-tars-protocol/protocol/TransactionFactoryImpl.h"
+#include "bcos-tars-protocol/protocol/WireCodec.h"
+#include "mock/LocalServiceClients.h"
+#include <benchmark/benchmark.h>
+#include <boost/lexical_cast.hpp>
+#include <gsl/span>
+
+using namespace bcostars;
+using namespace bcostars::bench;
+
+namespace
+{
+// the number of the objects prepared at a time for the operations caching their results, e.g.
+// hash(), so every iteration works on an object never hashed before
+constexpr size_t c_batchSize = 256;
+constexpr size_t c_blockBatchSize = 4;
+
+// the allocation budgets of decoding, about twice of the allocations of the objects and their
+// fields, so decoding a field into more than one allocation fails the benchmarks
+constexpr double c_transactionDecodeBudget = 24;
+constexpr double c_receiptDecodeBudget = 16;
+constexpr double c_eventDecodeBudget = 12;
+constexpr double c_blockHeaderDecodeBudget = 32;
+constexpr double c_sealerDecodeBudget = 4;
+
+bcos::crypto::CryptoSuite::Ptr cryptoSuite()
+{
+    return benchBlockFactory()->cryptoSuite();
+}
+
+bcos::crypto::KeyPairInterface::Ptr benchKeyPair()
+{
+    static auto s_keyPair = cryptoSuite()->signatureImpl()->generateKeyPair();
+    return s_keyPair;
+}
+
+// the signed transaction with _inputSize bytes input, e.g. 68 bytes of a token transfer and
+// kilobytes of a contract deployment
+bcostars::Transaction makeTransaction(size_t _inputSize, size_t _nonce = 0)
+{
+    auto transaction = benchBlockFactory()->transactionFactory()->createTransaction(0,
+        "0x5fe3c4c3e2079879a0dba1937aca95ac16e68f0f", bcos::bytes(_inputSize, 'i'),
+        bcos::u256(_nonce), 500, "chain0", "group0", 0, benchKeyPair());
+    return std::dynamic_pointer_cast<bcostars::protocol::TransactionImpl>(transaction)->inner();
+}
+
+// the receipt of a contract call emitting _logs events with three topics each
+bcostars::TransactionReceipt makeReceipt(size_t _logs)
+{
+    auto logEntries = std::make_shared<std::vector<bcos::protocol::LogEntry>>();
+    for (size_t i = 0; i < _logs; ++i)
+    {
+        bcos::h256s topics;
+        for (size_t j = 0; j < 3; ++j)
+        {
+            topics.push_back(bcos::h256(bcos::asBytes("topic" + std::to_string(i + j))));
+        }
+        logEntries->emplace_back(bcos::bytes(20, 'a'), topics, bcos::bytes(64, 'd'));
+    }
+    auto receipt = benchBlockFactory()->receiptFactory()->createReceipt(bcos::u256(21000),
+        "0x5fe3c4c3e2079879a0dba1937aca95ac16e68f0f", logEntries, 0, bcos::bytes(32, 'o'), 1);
+    return std::dynamic_pointer_cast<bcostars::protocol::TransactionReceiptImpl>(receipt)
+        ->inner();
+}
+
+// the header signed by all the _sealers sealers
+bcostars::BlockHeader makeBlockHeader(size_t _sealers)
+{
+    auto header = benchBlockFactory()->blockHeaderFactory()->createBlockHeader();
+    header->setNumber(100);
+    header->setGasUsed(21000);
+    header->setTimestamp(1634611200000);
+    header->setTxsRoot(bcos::crypto::HashType(bcos::bytes(32, 1)));
+    header->setReceiptsRoot(bcos::crypto::HashType(bcos::bytes(32, 2)));
+    header->setStateRoot(bcos::crypto::HashType(bcos::bytes(32, 3)));
+    bcos::protocol::ParentInfo parentInfo;
+    parentInfo.blockNumber = 99;
+    parentInfo.blockHash = bcos::crypto::HashType(bcos::bytes(32, 4));
+    header->setParentInfo(bcos::protocol::ParentInfoList{parentInfo});
+    std::vector<bcos::bytes> sealerList(_sealers, bcos::bytes(64, 's'));
+    header->setSealerList(gsl::span<const bcos::bytes>(sealerList));
+    std::vector<bcos::protocol::Signature> signatureList;
+    for (size_t i = 0; i < _sealers; ++i)
+    {
+        bcos::protocol::Signature signature;
+        signature.index = i;
+        signature.signature = bcos::bytes(65, 'g');
+        signatureList.push_back(signature);
+    }
+    header->setSignatureList(signatureList);
+    return std::dynamic_pointer_cast<bcostars::protocol::BlockHeaderImpl>(header)->inner();
+}
+
+// the block of _transactions transactions of 256 bytes input and their receipts
+bcostars::Block makeBlock(size_t _transactions)
+{
+    static std::map<size_t, bcostars::Block> s_blocks;
+    auto it = s_blocks.find(_transactions);
+    if (it != s_blocks.end())
+    {
+        return it->second;
+    }
+    bcostars::Block block;
+    block.blockHeader = makeBlockHeader(4);
+    for (size_t i = 0; i < _transactions; ++i)
+    {
+        block.transactions.emplace_back(makeTransaction(256, i));
+        block.receipts.emplace_back(makeReceipt(2));
+    }
+    return s_blocks.emplace(_transactions, std::move(block)).first->second;
+}
+
+template <typename Inner>
+bcos::bytes encodeInner(Inner const& _inner)
+{
+    tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
+    _inner.writeTo(output);
+    bcos::bytes buffer;
+    output.getByteBuffer().swap(buffer);
+    return buffer;
+}
+
+// the objects never encoded nor hashed, wrapping the copies of _inner
+std::shared_ptr<bcostars::protocol::TransactionImpl> freshTransaction(
+    bcostars::Transaction _inner)
+{
+    _inner.dataHash.clear();
+    return std::make_shared<bcostars::protocol::TransactionImpl>(
+        cryptoSuite(), [inner = std::move(_inner)]() mutable { return &inner; });
+}
+
+std::shared_ptr<bcostars::protocol::TransactionReceiptImpl> freshReceipt(
+    bcostars::TransactionReceipt _inner)
+{
+    _inner.dataHash.clear();
+    return std::make_shared<bcostars::protocol::TransactionReceiptImpl>(
+        cryptoSuite(), [inner = std::move(_inner)]() mutable { return &inner; });
+}
+
+std::shared_ptr<bcostars::protocol::BlockHeaderImpl> freshBlockHeader(
+    bcostars::BlockHeader _inner)
+{
+    _inner.dataHash.clear();
+    return std::make_shared<bcostars::protocol::BlockHeaderImpl>(
+        cryptoSuite(), [inner = std::move(_inner)]() mutable { return &inner; });
+}
+
+std::shared_ptr<bcostars::protocol::BlockImpl> freshBlock(bcostars::Block _inner)
+{
+    _inner.blockHeader.dataHash.clear();
+    for (auto& transaction : _inner.transactions)
+    {
+        transaction.dataHash.clear();
+    }
+    for (auto& receipt : _inner.receipts)
+    {
+        receipt.dataHash.clear();
+    }
+    auto block = std::make_shared<bcostars::protocol::BlockImpl>(
+        benchBlockFactory()->transactionFactory(), benchBlockFactory()->receiptFactory());
+    block->setInner(std::move(_inner));
+    return block;
+}
+
+// runs _op on one of the objects made by _make every iteration, and makes the next batch with
+// the timing paused once all of them are used
+template <typename Make, typename Op>
+void runBatched(benchmark::State& _state, size_t _batchSize, Make&& _make, Op&& _op)
+{
+    using Object = decltype(_make());
+    std::vector<Object> objects;
+    auto makeBatch = [&]() {
+        objects.clear();
+        for (size_t i = 0; i < _batchSize; ++i)
+        {
+            objects.emplace_back(_make());
+        }
+    };
+    makeBatch();
+    size_t index = 0;
+    AllocationMeter meter;
+    meter.start();
+    for (auto _ : _state)
+    {
+        if (index == objects.size())
+        {
+            meter.stop();
+            _state.PauseTiming();
+            makeBatch();
+            index = 0;
+            _state.ResumeTiming();
+            meter.start();
+        }
+        _op(objects[index++]);
+    }
+    meter.stop();
+    meter.report(_state);
+}
+
+// runs _op every iteration, failing if it allocates more than _budget times on average
+template <typename Op>
+void run(benchmark::State& _state, Op&& _op, double _budget = -1)
+{
+    AllocationMeter meter;
+    meter.setBudget(_budget);
+    meter.start();
+    for (auto _ : _state)
+    {
+        _op();
+    }
+    meter.stop();
+    meter.report(_state);
+}
+
+// the throughput reported in bytes/s of the encoded objects and ops/s
+void reportThroughput(benchmark::State& _state, size_t _encodedSize)
+{
+    _state.SetBytesProcessed(_state.iterations() * _encodedSize);
+    _state.SetItemsProcessed(_state.iterations());
+}
+}  // namespace
+
+// the transactions by the input size
+static void BM_transactionEncode(benchmark::State& _state)
+{
+    auto transaction = makeTransaction(_state.range(0));
+    runBatched(
+        _state, c_batchSize, [&]() { return freshTransaction(transaction); },
+        [](auto const& _transaction) { benchmark::DoNotOptimize(_transaction->encode(false)); });
+    reportThroughput(_state, encodeInner(transaction).size());
+}
+BENCHMARK(BM_transactionEncode)->Arg(68)->Arg(1024)->Arg(16384);
+
+static void BM_transactionDecode(benchmark::State& _state)
+{
+    auto encoded = encodeInner(makeTransaction(_state.range(0)));
+    auto factory = benchBlockFactory()->transactionFactory();
+    run(
+        _state, [&]() { benchmark::DoNotOptimize(factory->createTransaction(encoded, false)); },
+        c_transactionDecodeBudget);
+    reportThroughput(_state, encoded.size());
+}
+BENCHMARK(BM_transactionDecode)->Arg(68)->Arg(1024)->Arg(16384);
+
+// the fields and the hash for the admission checks of the txpool, without decoding the input
+static void BM_transactionPrecheck(benchmark::State& _state)
+{
+    auto encoded = encodeInner(makeTransaction(_state.range(0)));
+    auto factory = std::dynamic_pointer_cast<bcostars::protocol::TransactionFactoryImpl>(
+        benchBlockFactory()->transactionFactory());
+    run(_state,
+        [&]() { benchmark::DoNotOptimize(factory->precheckTransaction(bcos::ref(encoded))); });
+    reportThroughput(_state, encoded.size());
+}
+BENCHMARK(BM_transactionPrecheck)->Arg(68)->Arg(1024)->Arg(16384);
+
+static void BM_transactionHash(benchmark::State& _state)
+{
+    auto transaction = makeTransaction(_state.range(0));
+    runBatched(
+        _state, c_batchSize, [&]() { return freshTransaction(transaction); },
+        [](auto const& _transaction) { benchmark::DoNotOptimize(_transaction->hash()); });
+    reportThroughput(_state, encodeInner(transaction.data).size());
+}
+BENCHMARK(BM_transactionHash)->Arg(68)->Arg(1024)->Arg(16384);
+
+// recovers the sender from the signature, the hash is calculated before
+static void BM_transactionVerify(benchmark::State& _state)
+{
+    auto transaction = makeTransaction(_state.range(0));
+    runBatched(
+        _state, c_batchSize, [&]() { return freshTransaction(transaction); },
+        [](auto const& _transaction) {
+            _transaction->verify();
+            benchmark::DoNotOptimize(_transaction->sender());
+        });
+    reportThroughput(_state, encodeInner(transaction).size());
+}
+BENCHMARK(BM_transactionVerify)->Arg(68)->Arg(16384);
+
+// the receipts by the number of the events
+static void BM_receiptEncode(benchmark::State& _state)
+{
+    auto receipt = freshReceipt(makeReceipt(_state.range(0)));
+    bcos::bytes encoded;
+    run(_state, [&]() {
+        receipt->encode(encoded);
+        benchmark::DoNotOptimize(encoded);
+    });
+    reportThroughput(_state, encoded.size());
+}
+BENCHMARK(BM_receiptEncode)->Arg(0)->Arg(2)->Arg(16);
+
+static void BM_receiptDecode(benchmark::State& _state)
+{
+    auto encoded = encodeInner(makeReceipt(_state.range(0)));
+    auto factory = benchBlockFactory()->receiptFactory();
+    run(
+        _state, [&]() { benchmark::DoNotOptimize(factory->createReceipt(encoded)); },
+        c_receiptDecodeBudget + c_eventDecodeBudget * _state.range(0));
+    reportThroughput(_state, encoded.size());
+}
+BENCHMARK(BM_receiptDecode)->Arg(0)->Arg(2)->Arg(16);
+
+static void BM_receiptHash(benchmark::State& _state)
+{
+    auto receipt = makeReceipt(_state.range(0));
+    runBatched(
+        _state, c_batchSize, [&]() { return freshReceipt(receipt); },
+        [](auto const& _receipt) { benchmark::DoNotOptimize(_receipt->hash()); });
+    reportThroughput(_state, encodeInner(receipt.data).size());
+}
+BENCHMARK(BM_receiptHash)->Arg(0)->Arg(2)->Arg(16);
+
+// the block headers by the number of the sealers
+static void BM_blockHeaderEncode(benchmark::State& _state)
+{
+    auto header = freshBlockHeader(makeBlockHeader(_state.range(0)));
+    bcos::bytes encoded;
+    run(_state, [&]() {
+        header->encode(encoded);
+        benchmark::DoNotOptimize(encoded);
+    });
+    reportThroughput(_state, encoded.size());
+}
+BENCHMARK(BM_blockHeaderEncode)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_blockHeaderDecode(benchmark::State& _state)
+{
+    auto encoded = encodeInner(makeBlockHeader(_state.range(0)));
+    auto factory = benchBlockFactory()->blockHeaderFactory();
+    run(
+        _state, [&]() { benchmark::DoNotOptimize(factory->createBlockHeader(encoded)); },
+        c_blockHeaderDecodeBudget + c_sealerDecodeBudget * _state.range(0));
+    reportThroughput(_state, encoded.size());
+}
+BENCHMARK(BM_blockHeaderDecode)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_blockHeaderHash(benchmark::State& _state)
+{
+    auto header = makeBlockHeader(_state.range(0));
+    runBatched(
+        _state, c_batchSize, [&]() { return freshBlockHeader(header); },
+        [](auto const& _header) { benchmark::DoNotOptimize(_header->hash()); });
+    reportThroughput(_state, encodeInner(header.data).size());
+}
+BENCHMARK(BM_blockHeaderHash)->Arg(4)->Arg(16)->Arg(64);
+
+// the blocks by the number of the transactions
+static void BM_blockEncode(benchmark::State& _state)
+{
+    auto block = freshBlock(makeBlock(_state.range(0)));
+    bcos::bytes encoded;
+    run(_state, [&]() {
+        block->encode(encoded);
+        benchmark::DoNotOptimize(encoded);
+    });
+    reportThroughput(_state, encoded.size());
+}
+BENCHMARK(BM_blockEncode)->Arg(1)->Arg(100)->Arg(1000);
+
+static void BM_blockDecode(benchmark::State& _state)
+{
+    auto encoded = encodeInner(makeBlock(_state.range(0)));
+    run(
+        _state,
+        [&]() {
+            benchmark::DoNotOptimize(benchBlockFactory()->createBlock(encoded, false, false));
+        },
+        c_blockHeaderDecodeBudget +
+            (c_transactionDecodeBudget + c_receiptDecodeBudget + 2 * c_eventDecodeBudget) *
+                _state.range(0));
+    reportThroughput(_state, encoded.size());
+}
+BENCHMARK(BM_blockDecode)->Arg(1)->Arg(100)->Arg(1000);
+
+// the header and the last transaction of the block decoded eagerly (0), the header of the block
+// decoded lazily (1), and the header and the last transaction of it (2), for which the offsets of
+// the lists are recorded
+static void BM_blockOpen(benchmark::State& _state)
+{
+    auto encoded = std::make_shared<bcos::bytes const>(encodeInner(makeBlock(_state.range(0))));
+    auto factory =
+        std::dynamic_pointer_cast<bcostars::protocol::BlockFactoryImpl>(benchBlockFactory());
+    auto last = _state.range(0) - 1;
+    for (auto _ : _state)
+    {
+        bcos::protocol::Block::Ptr block;
+        if (_state.range(1) == 0)
+        {
+            block = factory->createBlock(*encoded, false, false);
+        }
+        else
+        {
+            block = factory->createBlockLazily(encoded);
+        }
+        benchmark::DoNotOptimize(block->blockHeaderConst()->number());
+        if (_state.range(1) != 1)
+        {
+            benchmark::DoNotOptimize(block->transaction(last)->nonce());
+        }
+    }
+    reportThroughput(_state, encoded->size());
+}
+BENCHMARK(BM_blockOpen)->ArgsProduct({{100, 1000, 50000}, {0, 1, 2}});
+
+// the hashes of the header, all the transactions and all the receipts
+static void BM_blockHash(benchmark::State& _state)
+{
+    auto block = makeBlock(_state.range(0));
+    runBatched(
+        _state, c_blockBatchSize, [&]() { return freshBlock(block); },
+        [](auto const& _block) {
+            benchmark::DoNotOptimize(_block->blockHeaderConst()->hash());
+            for (size_t i = 0; i < _block->transactionsSize(); ++i)
+            {
+                benchmark::DoNotOptimize(_block->transaction(i)->hash());
+                benchmark::DoNotOptimize(_block->receipt(i)->hash());
+            }
+        });
+    reportThroughput(_state, encodeInner(block).size());
+}
+BENCHMARK(BM_blockHash)->Arg(1)->Arg(100)->Arg(1000);
+
+// the signatures of all the transactions
+static void BM_blockVerify(benchmark::State& _state)
+{
+    auto block = makeBlock(_state.range(0));
+    runBatched(
+        _state, c_blockBatchSize, [&]() { return freshBlock(block); },
+        [](auto const& _block) {
+            for (size_t i = 0; i < _block->transactionsSize(); ++i)
+            {
+                auto transaction = _block->transaction(i);
+                transaction->verify();
+                benchmark::DoNotOptimize(transaction->sender());
+            }
+        });
+    reportThroughput(_state, encodeInner(block).size());
+}
+BENCHMARK(BM_blockVerify)->Arg(1)->Arg(100);
+
+namespace
+{
+// the nonces of the block of _count transactions in the encoding of the _version
+bcostars::Block makeNonceListBlock(size_t _count, int32_t _version)
+{
+    bcos::protocol::NonceList nonces;
+    for (size_t i = 0; i < _count; ++i)
+    {
+        nonces.push_back((bcos::u256(i) << 128) + i * 7919);
+    }
+    auto block = freshBlock(bcostars::Block());
+    block->setVersion(_version);
+    block->setNonceList(std::move(nonces));
+    return block->inner();
+}
+}  // namespace
+
+// the arguments are {transactions, version}, the version 1 carries the nonces in binary
+static void BM_blockSetNonceList(benchmark::State& _state)
+{
+    auto inner = makeNonceListBlock(_state.range(0), _state.range(1));
+    auto nonces = freshBlock(inner)->nonceList();
+    auto block = freshBlock(inner);
+    run(_state, [&]() { block->setNonceList(nonces); });
+    _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(BM_blockSetNonceList)->Args({20000, 0})->Args({20000, 1});
+
+static void BM_blockNonceList(benchmark::State& _state)
+{
+    auto inner = makeNonceListBlock(_state.range(0), _state.range(1));
+    runBatched(
+        _state, c_blockBatchSize, [&]() { return freshBlock(inner); },
+        [](auto const& _block) { benchmark::DoNotOptimize(_block->nonceList()); });
+    _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(BM_blockNonceList)->Args({20000, 0})->Args({20000, 1});
+
+namespace
+{
+// the values of about _digits decimal digits, as the nonces and gasUsed are
+std::vector<bcos::u256> makeDecimalValues(size_t _digits)
+{
+    std::vector<bcos::u256> values;
+    for (size_t i = 0; i < 256; ++i)
+    {
+        bcos::u256 value = 1 + i % 9;
+        for (size_t j = 1; j < _digits; ++j)
+        {
+            value = value * 10 + (i * 7919 + j) % 10;
+        }
+        values.push_back(value);
+    }
+    return values;
+}
+}  // namespace
+
+// the arguments are {digits, codec}, the codec 0 is boost::lexical_cast and 1 is DecimalCodec
+static void BM_decimalParse(benchmark::State& _state)
+{
+    std::vector<std::string> texts;
+    for (auto const& value : makeDecimalValues(_state.range(0)))
+    {
+        texts.push_back(boost::lexical_cast<std::string>(value));
+    }
+    size_t index = 0;
+    run(_state, [&]() {
+        auto const& text = texts[index++ % texts.size()];
+        if (_state.range(1) == 0)
+        {
+            benchmark::DoNotOptimize(boost::lexical_cast<bcos::u256>(text));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(bcostars::protocol::parseDecimalU256(text));
+        }
+    });
+    _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(BM_decimalParse)->ArgsProduct({{1, 20, 39, 78}, {0, 1}});
+
+static void BM_decimalFormat(benchmark::State& _state)
+{
+    auto values = makeDecimalValues(_state.range(0));
+    size_t index = 0;
+    run(_state, [&]() {
+        auto const& value = values[index++ % values.size()];
+        if (_state.range(1) == 0)
+        {
+            benchmark::DoNotOptimize(boost::lexical_cast<std::string>(value));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(bcostars::protocol::formatDecimalU256(value));
+        }
+    });
+    _state.SetItemsProcessed(_state.iterations());
+}
+BENCHMARK(BM_decimalFormat)->ArgsProduct({{1, 20, 39, 78}, {0, 1}});
+
+namespace
+{
+// the 32 bytes hashes of the block, each decoded into a vector<byte> buffer of its own
+size_t countHashFields(bcostars::Block const& _block)
+{
+    auto isHash = [](std::vector<tars::Char> const& _field) {
+        return _field.size() == bcos::crypto::HashType::size ? 1 : 0;
+    };
+    auto const& header = _block.blockHeader;
+    size_t count = isHash(header.dataHash) + isHash(header.data.txsRoot) +
+                   isHash(header.data.receiptRoot) + isHash(header.data.stateRoot);
+    for (auto const& parentInfo : header.data.parentInfo)
+    {
+        count += isHash(parentInfo.blockHash);
+    }
+    for (auto const& transaction : _block.transactions)
+    {
+        count += isHash(transaction.dataHash);
+    }
+    for (auto const& receipt : _block.receipts)
+    {
+        count += isHash(receipt.dataHash);
+    }
+    for (auto const& metaData : _block.transactionsMetaData)
+    {
+        count += isHash(metaData.hash);
+    }
+    for (auto const& receiptHash : _block.receiptsHash)
+    {
+        count += isHash(receiptHash);
+    }
+    return count;
+}
+}  // namespace
+
+// the memory held by the decoded block per transaction: the heap blocks and bytes, the share of
+// them taken by the hash fields, and the inline size of a transaction and its receipt
+static void BM_blockFootprint(benchmark::State& _state)
+{
+    auto encoded = encodeInner(makeBlock(_state.range(0)));
+    AllocationCounts total;
+    size_t hashFields = 0;
+    for (auto _ : _state)
+    {
+        auto begin = allocationTotals();
+        auto block = std::make_unique<bcostars::Block>();
+        tars::TarsInputStream<tars::BufferReader> input;
+        input.setBuffer((const char*)encoded.data(), encoded.size());
+        block->readFrom(input);
+        auto end = allocationTotals();
+        total.count += end.count - begin.count;
+        total.bytes += end.bytes - begin.bytes;
+        hashFields = countHashFields(*block);
+
+        _state.PauseTiming();
+        block.reset();
+        _state.ResumeTiming();
+    }
+    auto transactions = (double)_state.range(0) * (double)_state.iterations();
+    _state.counters["heapAllocs/tx"] = (double)total.count / transactions;
+    _state.counters["heapBytes/tx"] = (double)total.bytes / transactions;
+    _state.counters["hashAllocs/tx"] = (double)hashFields / (double)_state.range(0);
+    _state.counters["hashAllocs%"] =
+        100.0 * (double)hashFields * (double)_state.iterations() / (double)total.count;
+    _state.counters["inlineBytes/tx"] =
+        (double)(sizeof(bcostars::Transaction) + sizeof(bcostars::TransactionReceipt));
+}
+BENCHMARK(BM_blockFootprint)->Arg(100)->Arg(1000);
+
+// the generated readFrom (0) against the hand-written reader (1) of the transactions by the input
+// size, the struct is reused to leave the allocations of its fields out
+static void BM_transactionRead(benchmark::State& _state)
+{
+    auto encoded = encodeInner(makeTransaction(_state.range(0)));
+    bcostars::Transaction transaction;
+    for (auto _ : _state)
+    {
+        if (_state.range(1))
+        {
+            bcostars::protocol::readTransaction(bcos::ref(encoded), transaction);
+        }
+        else
+        {
+            tars::TarsInputStream<tars::BufferReader> input;
+            input.setBuffer((const char*)encoded.data(), encoded.size());
+            transaction.readFrom(input);
+        }
+        benchmark::DoNotOptimize(transaction);
+    }
+    reportThroughput(_state, encoded.size());
+}
+BENCHMARK(BM_transactionRead)->ArgsProduct({{68, 1024}, {0, 1}});
+
+static void BM_blockHeaderRead(benchmark::State& _state)
+{
+    auto encoded = encodeInner(makeBlockHeader(_state.range(0)));
+    bcostars::BlockHeader header;
+    for (auto _ : _state)
+    {
+        if (_state.range(1))
+        {
+            bcostars::protocol::readBlockHeader(bcos::ref(encoded), header);
+        }
+        else
+        {
+            tars::TarsInputStream<tars::BufferReader> input;
+            input.setBuffer((const char*)encoded.data(), encoded.size());
+            header.readFrom(input);
+        }
+        benchmark::DoNotOptimize(header);
+    }
+    reportThroughput(_state, encoded.size());
+}
+BENCHMARK(BM_blockHeaderRead)->ArgsProduct({{4, 64}, {0, 1}});
+
+// the hash of the decoded objects, arg 1 hashes the received data, arg 0 the same fields built
+// locally, whose data is written again
+template <typename Inner, typename Fresh>
+void runReceivedHash(benchmark::State& _state, Inner _inner, Fresh&& _fresh)
+{
+    _inner.dataHash.clear();
+    auto encoded = encodeInner(_inner);
+    runBatched(
+        _state, c_batchSize,
+        [&]() {
+            auto object = _fresh(_inner);
+            if (_state.range(1))
+            {
+                object->decode(bcos::ref(encoded));
+            }
+            return object;
+        },
+        [](auto const& _object) { benchmark::DoNotOptimize(_object->hash()); });
+    reportThroughput(_state, encodeInner(_inner.data).size());
+}
+
+static void BM_transactionReceivedHash(benchmark::State& _state)
+{
+    runReceivedHash(_state, makeTransaction(_state.range(0)), freshTransaction);
+}
+BENCHMARK(BM_transactionReceivedHash)->ArgsProduct({{68, 16384}, {0, 1}});
+
+static void BM_receiptReceivedHash(benchmark::State& _state)
+{
+    runReceivedHash(_state, makeReceipt(_state.range(0)), freshReceipt);
+}
+BENCHMARK(BM_receiptReceivedHash)->ArgsProduct({{2, 16}, {0, 1}});
+
+static void BM_blockHeaderReceivedHash(benchmark::State& _state)
+{
+    runReceivedHash(_state, makeBlockHeader(_state.range(0)), freshBlockHeader);
+}
+BENCHMARK(BM_blockHeaderReceivedHash)->ArgsProduct({{4, 64}, {0, 1}});
@@ -0,0 +1,255 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief benchmark the round trips of the service clients against the loopback mock servants
+ * @file ServiceClientBench.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "mock/LocalServiceClients.h"
+#include "bcos-tars-protocol/protocol/TransactionImpl.h"
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <future>
+
+using namespace bcostars;
+using namespace bcostars::bench;
+
+namespace
+{
+// issues _window requests at once and waits for all the responses, _invoke sends one request
+// calling the given completion from the response callback, so every round trip covers the
+// request encoding, the loopback dispatch to the mock servant and the response decoding
+template <typename Invoke>
+void roundTrips(benchmark::State& _state, int64_t _window, Invoke&& _invoke)
+{
+    for (auto _ : _state)
+    {
+        auto pending = std::make_shared<std::atomic<int64_t>>(_window);
+        auto finished = std::make_shared<std::promise<void>>();
+        auto future = finished->get_future();
+        auto onResponse = [pending, finished]() {
+            if (pending->fetch_sub(1) == 1)
+            {
+                finished->set_value();
+            }
+        };
+        for (int64_t i = 0; i < _window; ++i)
+        {
+            _invoke(onResponse);
+        }
+        future.wait();
+    }
+    _state.SetItemsProcessed(_state.iterations() * _window);
+}
+
+bcos::crypto::NodeIDPtr benchNodeID()
+{
+    auto keyFactory = benchBlockFactory()->cryptoSuite()->keyFactory();
+    return keyFactory->createKey(bcos::bytes(64, 1));
+}
+}  // namespace
+
+// the arguments of the benchmarks are {payloadSize or listSize, requests in flight}, the first
+// measures the latency of the single round trip and the others the throughput of the client
+static void BM_txpoolFillBlock(benchmark::State& _state)
+{
+    MockTxPoolService::config().payloadSize = 256;
+    auto client = localTxPoolClient();
+    auto hashList = std::make_shared<bcos::crypto::HashList>(_state.range(0));
+    roundTrips(_state, _state.range(1), [&](auto _onResponse) {
+        client->asyncFillBlock(hashList, [_onResponse](auto&& _error, auto&& _txs) {
+            benchmark::DoNotOptimize(_txs);
+            _onResponse();
+        });
+    });
+}
+BENCHMARK(BM_txpoolFillBlock)->Args({1, 1})->Args({100, 1})->Args({100, 64})->UseRealTime();
+
+static void BM_txpoolGetPendingTransactionSize(benchmark::State& _state)
+{
+    auto client = localTxPoolClient();
+    roundTrips(_state, _state.range(0), [&](auto _onResponse) {
+        client->asyncGetPendingTransactionSize([_onResponse](auto&& _error, size_t _size) {
+            benchmark::DoNotOptimize(_size);
+            _onResponse();
+        });
+    });
+}
+BENCHMARK(BM_txpoolGetPendingTransactionSize)->Arg(1)->Arg(64)->UseRealTime();
+
+static void BM_pbftGetView(benchmark::State& _state)
+{
+    auto client = localPBFTClient();
+    roundTrips(_state, _state.range(0), [&](auto _onResponse) {
+        client->asyncGetPBFTView([_onResponse](auto&& _error, auto _view) {
+            benchmark::DoNotOptimize(_view);
+            _onResponse();
+        });
+    });
+}
+BENCHMARK(BM_pbftGetView)->Arg(1)->Arg(64)->UseRealTime();
+
+static void BM_pbftGetSyncInfo(benchmark::State& _state)
+{
+    MockPBFTService::config().payloadSize = _state.range(0);
+    auto client = localPBFTClient();
+    roundTrips(_state, _state.range(1), [&](auto _onResponse) {
+        client->asyncGetSyncInfo([_onResponse](auto&& _error, std::string _syncInfo) {
+            benchmark::DoNotOptimize(_syncInfo);
+            _onResponse();
+        });
+    });
+    _state.SetBytesProcessed(_state.iterations() * _state.range(0) * _state.range(1));
+}
+BENCHMARK(BM_pbftGetSyncInfo)->Args({256, 1})->Args({65536, 1})->Args({256, 64})->UseRealTime();
+
+static void BM_schedulerCall(benchmark::State& _state)
+{
+    MockSchedulerService::config().payloadSize = _state.range(0);
+    auto client = localSchedulerClient();
+    auto inner = std::make_shared<bcostars::Transaction>(
+        MockLedgerService::makeBlockTemplate().transactions[0]);
+    auto transaction = std::make_shared<bcostars::protocol::TransactionImpl>(
+        benchBlockFactory()->cryptoSuite(), [inner]() { return inner.get(); });
+    roundTrips(_state, _state.range(1), [&](auto _onResponse) {
+        client->call(transaction, [_onResponse](auto&& _error, auto&& _receipt) {
+            benchmark::DoNotOptimize(_receipt);
+            _onResponse();
+        });
+    });
+}
+BENCHMARK(BM_schedulerCall)->Args({256, 1})->Args({4096, 1})->Args({256, 64})->UseRealTime();
+
+static void BM_schedulerGetCode(benchmark::State& _state)
+{
+    MockSchedulerService::config().payloadSize = _state.range(0);
+    auto client = localSchedulerClient();
+    roundTrips(_state, _state.range(1), [&](auto _onResponse) {
+        client->getCode("0x1234", [_onResponse](auto&& _error, bcos::bytes _code) {
+            benchmark::DoNotOptimize(_code);
+            _onResponse();
+        });
+    });
+    _state.SetBytesProcessed(_state.iterations() * _state.range(0) * _state.range(1));
+}
+BENCHMARK(BM_schedulerGetCode)->Args({4096, 1})->Args({65536, 1})->Args({4096, 64})->UseRealTime();
+
+static void BM_frontSendMessageByNodeID(benchmark::State& _state)
+{
+    MockFrontService::config().payloadSize = _state.range(0);
+    auto client = localFrontClient();
+    auto nodeID = benchNodeID();
+    bcos::bytes data(_state.range(0), 'd');
+    roundTrips(_state, _state.range(1), [&](auto _onResponse) {
+        // the moduleID of the consensus messages
+        client->asyncSendMessageByNodeID(1000, nodeID, bcos::ref(data), 0,
+            [_onResponse](auto&& _error, auto&&, auto&& _response, auto&&...) {
+                benchmark::DoNotOptimize(_response);
+                _onResponse();
+            });
+    });
+    _state.SetBytesProcessed(_state.iterations() * _state.range(0) * _state.range(1) * 2);
+}
+BENCHMARK(BM_frontSendMessageByNodeID)
+    ->Args({256, 1})
+    ->Args({65536, 1})
+    ->Args({256, 64})
+    ->UseRealTime();
+
+static void BM_frontGetNodeIDs(benchmark::State& _state)
+{
+    MockFrontService::config().listSize = _state.range(0);
+    auto client = localFrontClient();
+    roundTrips(_state, _state.range(1), [&](auto _onResponse) {
+        client->asyncGetNodeIDs([_onResponse](auto&& _error, auto&& _nodeIDs) {
+            benchmark::DoNotOptimize(_nodeIDs);
+            _onResponse();
+        });
+    });
+}
+BENCHMARK(BM_frontGetNodeIDs)->Args({4, 1})->Args({100, 1})->Args({4, 64})->UseRealTime();
+
+static void BM_gatewaySendMessageByNodeID(benchmark::State& _state)
+{
+    auto client = localGatewayClient();
+    auto nodeID = benchNodeID();
+    bcos::bytes payload(_state.range(0), 'p');
+    roundTrips(_state, _state.range(1), [&](auto _onResponse) {
+        client->asyncSendMessageByNodeID(
+            "group0", nodeID, nodeID, bcos::ref(payload), [_onResponse](auto&& _error) {
+                benchmark::DoNotOptimize(_error);
+                _onResponse();
+            });
+    });
+    _state.SetBytesProcessed(_state.iterations() * _state.range(0) * _state.range(1));
+}
+BENCHMARK(BM_gatewaySendMessageByNodeID)
+    ->Args({256, 1})
+    ->Args({65536, 1})
+    ->Args({256, 64})
+    ->UseRealTime();
+
+static void BM_gatewayGetPeers(benchmark::State& _state)
+{
+    MockGatewayService::config().listSize = _state.range(0);
+    auto client = localGatewayClient();
+    roundTrips(_state, _state.range(1), [&](auto _onResponse) {
+        client->asyncGetPeers([_onResponse](auto&& _error, auto&& _localInfo, auto&& _peers) {
+            benchmark::DoNotOptimize(_peers);
+            _onResponse();
+        });
+    });
+}
+BENCHMARK(BM_gatewayGetPeers)->Args({4, 1})->Args({100, 1})->Args({4, 64})->UseRealTime();
+
+static void BM_rpcNotifyAMOPMessage(benchmark::State& _state)
+{
+    MockRpcService::config().payloadSize = _state.range(0);
+    auto client = localRpcClient();
+    bcos::bytes data(_state.range(0), 'd');
+    roundTrips(_state, _state.range(1), [&](auto _onResponse) {
+        client->asyncNotifyAMOPMessage(
+            0, "topic", bcos::ref(data), [_onResponse](auto&& _error, auto&& _response) {
+                benchmark::DoNotOptimize(_response);
+                _onResponse();
+            });
+    });
+    _state.SetBytesProcessed(_state.iterations() * _state.range(0) * _state.range(1) * 2);
+}
+BENCHMARK(BM_rpcNotifyAMOPMessage)
+    ->Args({256, 1})
+    ->Args({65536, 1})
+    ->Args({256, 64})
+    ->UseRealTime();
+
+// the servant processing time hides the transport once the window covers it
+static void BM_txpoolVerifyBlockWithDelay(benchmark::State& _state)
+{
+    MockTxPoolService::config().delay = std::chrono::microseconds(_state.range(0));
+    auto client = localTxPoolClient();
+    auto nodeID = benchNodeID();
+    bcos::bytes encodedBlock;
+    benchBlockFactory()->createBlock()->encode(encodedBlock);
+    roundTrips(_state, _state.range(1), [&](auto _onResponse) {
+        client->asyncVerifyBlock(
+            nodeID, bcos::ref(encodedBlock), [_onResponse](auto&& _error, bool _result) {
+                benchmark::DoNotOptimize(_result);
+                _onResponse();
+            });
+    });
+    MockTxPoolService::config().delay = std::chrono::microseconds(0);
+}
+BENCHMARK(BM_txpoolVerifyBlockWithDelay)->Args({100, 1})->Args({100, 4})->UseRealTime();
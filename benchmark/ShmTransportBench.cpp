@@ -0,0 +1,129 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief benchmark the round trips over the shared memory rings
+ * @file ShmTransportBench.cpp
+ * @author: agent
+ * @date 2026-10-19
+ */
+#include "bcos-tars-protocol/client/ShmTransport.h"
+#include "bcos-tars-protocol/client/TxPoolServiceClient.h"
+#include "mock/LocalServiceClients.h"
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+#include <future>
+
+using namespace bcostars;
+using namespace bcostars::bench;
+
+namespace
+{
+// the server and the client polling threads run in the benchmark process, as two services on
+// the same host would, but without the process switches
+struct ShmChannel
+{
+    explicit ShmChannel(std::string const& _name)
+      : server(std::make_shared<ShmTransportServer>(_name + std::to_string(getpid())))
+    {
+        server->registerHandler(
+            "echo", [](tars::RequestPacket&& _request, ShmTransportServer::Responder _respond) {
+                _respond(tars::TARSSERVERSUCCESS, std::move(_request.sBuffer));
+            });
+        auto transactions = MockLedgerService::makeBlockTemplate().transactions;
+        server->registerHandler("asyncFillBlock",
+            [transactions](tars::RequestPacket&& _request, ShmTransportServer::Responder _respond) {
+                tars::TarsInputStream<tars::BufferReader> input;
+                input.setBuffer(_request.sBuffer.data(), _request.sBuffer.size());
+                vector<vector<tars::Char>> hashList;
+                input.read(hashList, 1, true);
+                vector<bcostars::Transaction> filled;
+                for (size_t i = 0; i < hashList.size(); ++i)
+                {
+                    filled.emplace_back(transactions[i % transactions.size()]);
+                }
+                _respond(tars::TARSSERVERSUCCESS, encodeShmResult(bcostars::Error(), 2, filled));
+            });
+        server->start();
+        client = std::make_shared<ShmTransportClient>(
+            _name + std::to_string(getpid()), "bcos.TxPoolService.TxPoolServiceObj");
+    }
+
+    ShmTransportServer::Ptr server;
+    ShmTransportClient::Ptr client;
+};
+
+ShmChannel& shmChannel()
+{
+    static ShmChannel s_channel("bcos-bench-shm-");
+    return s_channel;
+}
+}  // namespace
+
+static void BM_shmEcho(benchmark::State& _state)
+{
+    auto& channel = shmChannel();
+    std::vector<tars::Char> payload(_state.range(0), 'a');
+    for (auto _ : _state)
+    {
+        std::promise<void> finished;
+        channel.client->invoke("echo", std::vector<tars::Char>(payload), {},
+            [&finished](tars::Int32 _ret, tars::ResponsePacket&& _response) {
+                benchmark::DoNotOptimize(_response);
+                finished.set_value();
+            });
+        finished.get_future().wait();
+    }
+    _state.SetBytesProcessed(_state.iterations() * payload.size() * 2);
+}
+BENCHMARK(BM_shmEcho)->Arg(64)->Arg(4096)->Arg(65536)->UseRealTime();
+
+// the loopback tcp baseline of the smallest request
+static void BM_tarsGetBlockNumber(benchmark::State& _state)
+{
+    auto client = localLedgerClient();
+    for (auto _ : _state)
+    {
+        std::promise<void> finished;
+        client->asyncGetBlockNumber(
+            [&finished](bcos::Error::Ptr, bcos::protocol::BlockNumber _blockNumber) {
+                benchmark::DoNotOptimize(_blockNumber);
+                finished.set_value();
+            });
+        finished.get_future().wait();
+    }
+}
+BENCHMARK(BM_tarsGetBlockNumber)->UseRealTime();
+
+// the consensus hot path through the txpool client
+static void BM_shmFillBlock(benchmark::State& _state)
+{
+    auto blockFactory = benchBlockFactory();
+    auto client = std::make_shared<TxPoolServiceClient>(
+        TxPoolServicePrx(), blockFactory->cryptoSuite(), blockFactory);
+    client->setShmTransport(shmChannel().client);
+    auto hashList = std::make_shared<bcos::crypto::HashList>(_state.range(0));
+    for (auto _ : _state)
+    {
+        std::promise<void> finished;
+        client->asyncFillBlock(
+            hashList, [&finished](bcos::Error::Ptr, bcos::protocol::TransactionsPtr _txs) {
+                benchmark::DoNotOptimize(_txs);
+                finished.set_value();
+            });
+        finished.get_future().wait();
+    }
+    _state.SetItemsProcessed(_state.iterations() * _state.range(0));
+}
+BENCHMARK(BM_shmFillBlock)->Arg(1)->Arg(100)->Arg(1000)->UseRealTime();
@@ -0,0 +1,193 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief run tars servants on the loopback interface in the current process
+ * @file LocalServantApplication.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include <tarscpp/servant/Application.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bcostars
+{
+namespace bench
+{
+// tars allows only one Application in a process, so all the local servants must be added before
+// the application is started
+class LocalServantApplication : public tars::Application
+{
+public:
+    static constexpr const char* c_app = "bcos";
+    static constexpr const char* c_server = "LocalServant";
+    static constexpr const char* c_host = "127.0.0.1";
+
+    static LocalServantApplication& instance()
+    {
+        static LocalServantApplication s_instance;
+        return s_instance;
+    }
+    ~LocalServantApplication() override { stop(); }
+
+    template <typename T>
+    void addLocalServant(std::string const& _objName, uint16_t _port, size_t _threads = 4)
+    {
+        m_servants.push_back(LocalServant{_objName, _port, _threads,
+            [](LocalServantApplication& _app, std::string const& _id) {
+                _app.template addServantOf<T>(_id);
+            }});
+    }
+
+    void start()
+    {
+        if (m_started)
+        {
+            return;
+        }
+        m_started = true;
+        auto config = makeConfig();
+        m_thread = std::thread([this, config]() {
+            main(config);
+            waitForShutdown();
+        });
+        for (auto const& servant : m_servants)
+        {
+            waitForPort(servant.port);
+        }
+    }
+
+    void stop()
+    {
+        if (!m_started)
+        {
+            return;
+        }
+        m_started = false;
+        terminate();
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+    }
+
+    template <typename Prx>
+    Prx proxy(std::string const& _objName)
+    {
+        for (auto const& servant : m_servants)
+        {
+            if (servant.objName == _objName)
+            {
+                return getCommunicator()->stringToProxy<Prx>(servantID(_objName) + "@tcp -h " +
+                                                            c_host + " -p " +
+                                                            std::to_string(servant.port));
+            }
+        }
+        return Prx();
+    }
+
+protected:
+    void initialize() override
+    {
+        for (auto const& servant : m_servants)
+        {
+            servant.add(*this, servantID(servant.objName));
+        }
+    }
+    void destroyApp() override {}
+
+private:
+    struct LocalServant
+    {
+        std::string objName;
+        uint16_t port;
+        size_t threads;
+        std::function<void(LocalServantApplication&, std::string const&)> add;
+    };
+
+    LocalServantApplication() = default;
+
+    template <typename T>
+    void addServantOf(std::string const& _id)
+    {
+        addServant<T>(_id);
+    }
+
+    static std::string servantID(std::string const& _objName)
+    {
+        return std::string(c_app) + "." + c_server + "." + _objName;
+    }
+
+    std::string makeConfig() const
+    {
+        auto basePath = (std::filesystem::temp_directory_path() / "bcos-local-servant").string();
+        std::filesystem::create_directories(basePath);
+        std::stringstream config;
+        config << "<tars>\n<application>\n<client>\n"
+               << "sync-invoke-timeout=60000\nasync-invoke-timeout=60000\n"
+               << "netthread=2\nasyncthread=8\n</client>\n<server>\n"
+               << "app=" << c_app << "\nserver=" << c_server << "\n"
+               << "localip=" << c_host << "\nbasepath=" << basePath << "\n"
+               << "datapath=" << basePath << "\nlogpath=" << basePath << "\n"
+               << "logLevel=ERROR\ncloseout=0\nnetthread=2\n";
+        for (auto const& servant : m_servants)
+        {
+            auto id = servantID(servant.objName);
+            config << "<" << id << "Adapter>\n"
+                   << "allow\nendpoint=tcp -h " << c_host << " -p " << servant.port
+                   << " -t 60000\nmaxconns=1024\nprotocol=tars\nqueuecap=1000000\n"
+                   << "queuetimeout=60000\nservant=" << id << "\nthreads=" << servant.threads
+                   << "\n</" << id << "Adapter>\n";
+        }
+        config << "</server>\n</application>\n</tars>\n";
+        return config.str();
+    }
+
+    static void waitForPort(uint16_t _port)
+    {
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(_port);
+        inet_pton(AF_INET, c_host, &address.sin_addr);
+        for (int i = 0; i < 500; ++i)
+        {
+            auto fd = socket(AF_INET, SOCK_STREAM, 0);
+            auto ret = connect(fd, (sockaddr*)&address, sizeof(address));
+            close(fd);
+            if (ret == 0)
+            {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    std::vector<LocalServant> m_servants;
+    bool m_started = false;
+    std::thread m_thread;
+};
+}  // namespace bench
+}  // namespace bcostars
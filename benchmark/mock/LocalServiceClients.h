@@ -0,0 +1,147 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the clients connected to the local mock servants
+ * @file LocalServiceClients.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "LocalServantApplication.h"
+#include "MockFrontService.h"
+#include "MockGatewayService.h"
+#include "MockLedgerService.h"
+#include "MockPBFTService.h"
+#include "MockRpcService.h"
+#include "MockSchedulerService.h"
+#include "MockTxPoolService.h"
+#include "bcos-tars-protocol/client/FrontServiceClient.h"
+#include "bcos-tars-protocol/client/GatewayServiceClient.h"
+#include "bcos-tars-protocol/client/LedgerServiceClient.h"
+#include "bcos-tars-protocol/client/PBFTServiceClient.h"
+#include "bcos-tars-protocol/client/RpcServiceClient.h"
+#include "bcos-tars-protocol/client/SchedulerServiceClient.h"
+#include "bcos-tars-protocol/client/TxPoolServiceClient.h"
+#include "bcos-tars-protocol/protocol/BlockFactoryImpl.h"
+#include "bcos-tars-protocol/protocol/BlockHeaderFactoryImpl.h"
+#include "bcos-tars-protocol/protocol/TransactionFactoryImpl.h"
+#include "bcos-tars-protocol/protocol/TransactionReceiptFactoryImpl.h"
+#include <bcos-framework/testutils/crypto/HashImpl.h>
+#include <bcos-framework/testutils/crypto/SignatureImpl.h>
+
+namespace bcostars
+{
+namespace bench
+{
+inline bcos::protocol::BlockFactory::Ptr benchBlockFactory()
+{
+    static bcos::protocol::BlockFactory::Ptr s_blockFactory = []() {
+        auto cryptoSuite =
+            std::make_shared<bcos::crypto::CryptoSuite>(std::make_shared<bcos::test::Sm3Hash>(),
+                std::make_shared<bcos::test::SM2SignatureImpl>(), nullptr);
+        return std::make_shared<bcostars::protocol::BlockFactoryImpl>(cryptoSuite,
+            std::make_shared<bcostars::protocol::BlockHeaderFactoryImpl>(cryptoSuite),
+            std::make_shared<bcostars::protocol::TransactionFactoryImpl>(cryptoSuite),
+            std::make_shared<bcostars::protocol::TransactionReceiptFactoryImpl>(cryptoSuite));
+    }();
+    return s_blockFactory;
+}
+
+namespace detail
+{
+constexpr uint16_t c_ledgerPort = 32101;
+constexpr uint16_t c_txPoolPort = 32102;
+constexpr uint16_t c_pbftPort = 32103;
+constexpr uint16_t c_schedulerPort = 32104;
+constexpr uint16_t c_frontPort = 32105;
+constexpr uint16_t c_gatewayPort = 32106;
+constexpr uint16_t c_rpcPort = 32107;
+
+// the servants can't be added once the application started, so all of them are registered by
+// the first benchmark requiring any
+inline LocalServantApplication& localApplication()
+{
+    static LocalServantApplication& s_application = []() -> LocalServantApplication& {
+        auto& application = LocalServantApplication::instance();
+        application.addLocalServant<MockLedgerService>("LedgerServiceObj", c_ledgerPort);
+        application.addLocalServant<MockTxPoolService>("TxPoolServiceObj", c_txPoolPort);
+        application.addLocalServant<MockPBFTService>("PBFTServiceObj", c_pbftPort);
+        application.addLocalServant<MockSchedulerService>("SchedulerServiceObj", c_schedulerPort);
+        application.addLocalServant<MockFrontService>("FrontServiceObj", c_frontPort);
+        application.addLocalServant<MockGatewayService>("GatewayServiceObj", c_gatewayPort);
+        application.addLocalServant<MockRpcService>("RpcServiceObj", c_rpcPort);
+        application.start();
+        return application;
+    }();
+    return s_application;
+}
+}  // namespace detail
+
+// the clients are shared by all the benchmarks
+inline std::shared_ptr<bcostars::LedgerServiceClient> localLedgerClient()
+{
+    static auto s_client = std::make_shared<bcostars::LedgerServiceClient>(
+        detail::localApplication().proxy<bcostars::LedgerServicePrx>("LedgerServiceObj"),
+        benchBlockFactory());
+    return s_client;
+}
+
+inline std::shared_ptr<bcostars::TxPoolServiceClient> localTxPoolClient()
+{
+    static auto s_client = std::make_shared<bcostars::TxPoolServiceClient>(
+        detail::localApplication().proxy<bcostars::TxPoolServicePrx>("TxPoolServiceObj"),
+        benchBlockFactory()->cryptoSuite(), benchBlockFactory());
+    return s_client;
+}
+
+inline std::shared_ptr<bcostars::PBFTServiceClient> localPBFTClient()
+{
+    static auto s_client = std::make_shared<bcostars::PBFTServiceClient>(
+        detail::localApplication().proxy<bcostars::PBFTServicePrx>("PBFTServiceObj"));
+    return s_client;
+}
+
+inline std::shared_ptr<bcostars::SchedulerServiceClient> localSchedulerClient()
+{
+    static auto s_client = std::make_shared<bcostars::SchedulerServiceClient>(
+        detail::localApplication().proxy<bcostars::SchedulerServicePrx>("SchedulerServiceObj"),
+        benchBlockFactory()->cryptoSuite());
+    return s_client;
+}
+
+inline std::shared_ptr<bcostars::FrontServiceClient> localFrontClient()
+{
+    static auto s_client = std::make_shared<bcostars::FrontServiceClient>(
+        detail::localApplication().proxy<bcostars::FrontServicePrx>("FrontServiceObj"),
+        benchBlockFactory()->cryptoSuite()->keyFactory());
+    return s_client;
+}
+
+inline std::shared_ptr<bcostars::GatewayServiceClient> localGatewayClient()
+{
+    static auto s_client = std::make_shared<bcostars::GatewayServiceClient>(
+        detail::localApplication().proxy<bcostars::GatewayServicePrx>("GatewayServiceObj"),
+        benchBlockFactory()->cryptoSuite()->keyFactory());
+    return s_client;
+}
+
+inline std::shared_ptr<bcostars::RpcServiceClient> localRpcClient()
+{
+    static auto s_client = std::make_shared<bcostars::RpcServiceClient>(
+        detail::localApplication().proxy<bcostars::RpcServicePrx>("RpcServiceObj"));
+    return s_client;
+}
+}  // namespace bench
+}  // namespace bcostars
@@ -0,0 +1,94 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the stand-in front servant answering with the generated messages
+ * @file MockFrontService.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "MockServant.h"
+#include "bcos-tars-protocol/tars/FrontService.h"
+
+namespace bcostars
+{
+namespace bench
+{
+class MockFrontService : public MockServant<bcostars::FrontService>
+{
+public:
+    bcostars::Error asyncGetNodeIDs(
+        vector<vector<tars::Char>>& _nodeIDs, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _nodeIDs = nodeIDList();
+        return bcostars::Error();
+    }
+
+    bcostars::Error onReceivedNodeIDs(
+        const std::string&, const vector<vector<tars::Char>>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error onReceiveMessage(const std::string&, const vector<tars::Char>&,
+        const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error onReceiveBroadcastMessage(const std::string&, const vector<tars::Char>&,
+        const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    // responds with the payload of the configured size, as the peer does
+    bcostars::Error asyncSendMessageByNodeID(tars::Int32, const vector<tars::Char>& _nodeID,
+        const vector<tars::Char>&, tars::UInt32, tars::Bool,
+        vector<tars::Char>& _responseNodeID, vector<tars::Char>& _responseData,
+        std::string& _seq, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _responseNodeID = _nodeID;
+        _responseData = payload();
+        _seq = "0";
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncSendResponse(const std::string&, tars::Int32, const vector<tars::Char>&,
+        const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    void asyncSendMessageByNodeIDs(tars::Int32, const vector<vector<tars::Char>>&,
+        const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+    }
+
+    void asyncSendBroadcastMessage(
+        tars::Int32, const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+    }
+};
+}  // namespace bench
+}  // namespace bcostars
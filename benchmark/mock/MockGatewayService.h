@@ -0,0 +1,122 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the stand-in gateway servant answering with the generated peers
+ * @file MockGatewayService.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "MockServant.h"
+#include "bcos-tars-protocol/tars/GatewayService.h"
+
+namespace bcostars
+{
+namespace bench
+{
+class MockGatewayService : public MockServant<bcostars::GatewayService>
+{
+public:
+    bcostars::Error asyncSendMessageByNodeID(const std::string&, const vector<tars::Char>&,
+        const vector<tars::Char>&, const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncSendMessageByNodeIDs(const std::string&, const vector<tars::Char>&,
+        const vector<vector<tars::Char>>&, const vector<tars::Char>&,
+        tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncSendBroadcastMessage(const std::string&, const vector<tars::Char>&,
+        const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetPeers(bcostars::GatewayInfo& _localInfo,
+        vector<bcostars::GatewayInfo>& _peers, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _localInfo = makeGatewayInfo(0);
+        for (size_t i = 1; i <= config().listSize; ++i)
+        {
+            _peers.emplace_back(makeGatewayInfo(i));
+        }
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetNodeIDs(const std::string&, vector<vector<tars::Char>>& _nodeIDs,
+        tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _nodeIDs = nodeIDList();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncNotifyGroupInfo(
+        const bcostars::GroupInfo&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncSendMessageByTopic(const std::string&, const vector<tars::Char>&,
+        tars::Int32& _type, vector<tars::Char>& _responseData, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _type = 0;
+        _responseData = payload();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncSendBroadbastMessageByTopic(
+        const std::string&, const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncSubscribeTopic(
+        const std::string&, const std::string&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncRemoveTopic(
+        const std::string&, const vector<std::string>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+private:
+    static bcostars::GatewayInfo makeGatewayInfo(size_t _index)
+    {
+        bcostars::GatewayInfo info;
+        info.p2pInfo.p2pID = std::string(128, (char)('a' + _index % 26));
+        info.p2pInfo.host = "127.0.0.1";
+        info.p2pInfo.port = 30300 + (tars::Int32)_index;
+        return info;
+    }
+};
+}  // namespace bench
+}  // namespace bcostars
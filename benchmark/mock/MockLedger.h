@@ -0,0 +1,155 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the in-process mock ledger, answering as the mock ledger servant does
+ * @file MockLedger.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "LocalServiceClients.h"
+#include "MockLedgerService.h"
+#include <bcos-framework/interfaces/ledger/LedgerInterface.h>
+
+namespace bcostars
+{
+namespace bench
+{
+// the blocks are decoded once and returned by shared pointer, as a ledger in the same process
+// returns the blocks it holds
+class MockLedger : public bcos::ledger::LedgerInterface
+{
+public:
+    MockLedger()
+    {
+        tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
+        MockLedgerService::makeBlockTemplate().writeTo(output);
+        m_block = benchBlockFactory()->createBlock(output.getByteBuffer(), false, false);
+    }
+    ~MockLedger() override {}
+
+    void asyncPrewriteBlock(bcos::storage::StorageInterface::Ptr, bcos::protocol::Block::ConstPtr,
+        std::function<void(bcos::Error::Ptr&&)> _callback) override
+    {
+        _callback(nullptr);
+    }
+
+    void asyncStoreTransactions(std::shared_ptr<std::vector<bcos::bytesConstPtr>>,
+        bcos::crypto::HashListPtr, std::function<void(bcos::Error::Ptr)> _onTxsStored) override
+    {
+        _onTxsStored(nullptr);
+    }
+
+    void asyncGetBlockDataByNumber(bcos::protocol::BlockNumber _blockNumber, int32_t,
+        std::function<void(bcos::Error::Ptr, bcos::protocol::Block::Ptr)> _onGetBlock) override
+    {
+        simulateDelay();
+        if (_blockNumber > MockLedgerService::config().latestBlockNumber)
+        {
+            _onGetBlock(std::make_shared<bcos::Error>(-1, "block not found"), nullptr);
+            return;
+        }
+        _onGetBlock(nullptr, m_block);
+    }
+
+    void asyncGetBlockNumber(
+        std::function<void(bcos::Error::Ptr, bcos::protocol::BlockNumber)> _onGetBlock) override
+    {
+        simulateDelay();
+        _onGetBlock(nullptr, MockLedgerService::config().latestBlockNumber);
+    }
+
+    void asyncGetBlockHashByNumber(bcos::protocol::BlockNumber _blockNumber,
+        std::function<void(bcos::Error::Ptr, bcos::crypto::HashType)> _onGetBlock) override
+    {
+        simulateDelay();
+        bcos::crypto::HashType blockHash;
+        std::copy_n((bcos::byte*)&_blockNumber, sizeof(_blockNumber), blockHash.data());
+        _onGetBlock(nullptr, blockHash);
+    }
+
+    void asyncGetBlockNumberByHash(bcos::crypto::HashType const& _blockHash,
+        std::function<void(bcos::Error::Ptr, bcos::protocol::BlockNumber)> _onGetBlock) override
+    {
+        simulateDelay();
+        bcos::protocol::BlockNumber blockNumber = 0;
+        std::copy_n(_blockHash.data(), sizeof(blockNumber), (bcos::byte*)&blockNumber);
+        _onGetBlock(nullptr, blockNumber);
+    }
+
+    void asyncGetBatchTxsByHashList(bcos::crypto::HashListPtr _txHashList, bool,
+        std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr,
+            std::shared_ptr<std::map<std::string, bcos::ledger::MerkleProofPtr>>)>
+            _onGetTx) override
+    {
+        simulateDelay();
+        auto transactions = std::make_shared<bcos::protocol::Transactions>();
+        for (size_t i = 0; i < _txHashList->size(); ++i)
+        {
+            transactions->emplace_back(std::const_pointer_cast<bcos::protocol::Transaction>(
+                m_block->transaction(i % m_block->transactionsSize())));
+        }
+        _onGetTx(nullptr, std::move(transactions), nullptr);
+    }
+
+    void asyncGetTransactionReceiptByHash(bcos::crypto::HashType const&, bool,
+        std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionReceipt::ConstPtr,
+            bcos::ledger::MerkleProofPtr)>
+            _onGetTx) override
+    {
+        _onGetTx(std::make_shared<bcos::Error>(-1, "unsupported by the mock ledger"), nullptr,
+            nullptr);
+    }
+
+    void asyncGetTotalTransactionCount(std::function<void(bcos::Error::Ptr, int64_t _totalTxCount,
+            int64_t _failedTxCount, bcos::protocol::BlockNumber _latestBlockNumber)>
+            _callback) override
+    {
+        simulateDelay();
+        auto blockNumber = MockLedgerService::config().latestBlockNumber;
+        _callback(nullptr,
+            blockNumber * (int64_t)MockLedgerService::config().transactionsPerBlock, 0,
+            blockNumber);
+    }
+
+    void asyncGetSystemConfigByKey(std::string const&,
+        std::function<void(bcos::Error::Ptr, std::string, bcos::protocol::BlockNumber)>
+            _onGetConfig) override
+    {
+        _onGetConfig(std::make_shared<bcos::Error>(-1, "unsupported by the mock ledger"), "", 0);
+    }
+
+    void asyncGetNodeListByType(std::string const&,
+        std::function<void(bcos::Error::Ptr, bcos::consensus::ConsensusNodeListPtr)> _onGetConfig)
+        override
+    {
+        _onGetConfig(std::make_shared<bcos::Error>(-1, "unsupported by the mock ledger"), nullptr);
+    }
+
+    void asyncGetNonceList(bcos::protocol::BlockNumber, int64_t,
+        std::function<void(bcos::Error::Ptr,
+            std::shared_ptr<std::map<bcos::protocol::BlockNumber, bcos::protocol::NonceListPtr>>)>
+            _onGetList) override
+    {
+        _onGetList(std::make_shared<bcos::Error>(-1, "unsupported by the mock ledger"), nullptr);
+    }
+
+private:
+    static void simulateDelay() { MockLedgerService::simulateDelay(); }
+
+    bcos::protocol::Block::Ptr m_block;
+};
+}  // namespace bench
+}  // namespace bcostars
@@ -0,0 +1,321 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief stand-in ledger servant serving generated blocks
+ * @file MockLedgerService.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/Common.h"
+#include "bcos-tars-protocol/protocol/BlockChunk.h"
+#include "bcos-tars-protocol/protocol/MerkleProofView.h"
+#include "bcos-tars-protocol/protocol/PresenceBitmap.h"
+#include "bcos-tars-protocol/tars/LedgerService.h"
+#include <bcos-framework/libutilities/DataConvertUtility.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace bcostars
+{
+namespace bench
+{
+struct MockLedgerConfig
+{
+    int64_t latestBlockNumber = 100000;
+    size_t transactionsPerBlock = 10;
+    size_t transactionInputSize = 256;
+    // the levels of the merkle proofs, with one sibling on every level
+    size_t proofLevels = 16;
+    // the processing time of every request
+    std::chrono::microseconds delay = std::chrono::microseconds(0);
+};
+
+class MockLedgerService : public bcostars::LedgerService
+{
+public:
+    // Note: tars creates a servant for every handle thread, so the config is shared
+    static MockLedgerConfig& config()
+    {
+        static MockLedgerConfig s_config;
+        return s_config;
+    }
+
+    // shared by the servants of all the handle threads
+    static bcostars::protocol::BlockChunkerCache& chunkerCache()
+    {
+        static bcostars::protocol::BlockChunkerCache s_chunkerCache;
+        return s_chunkerCache;
+    }
+
+    static void simulateDelay()
+    {
+        auto delay = config().delay;
+        if (delay.count() > 0)
+        {
+            std::this_thread::sleep_for(delay);
+        }
+    }
+
+    // the block responded by the mock, shared with the in-process mock ledger
+    static bcostars::Block makeBlockTemplate()
+    {
+        auto const& mockConfig = config();
+        bcostars::Block block;
+        block.blockHeader.data.gasUsed = "0";
+        block.blockHeader.dataHash.assign(32, 1);
+        for (size_t i = 0; i < mockConfig.transactionsPerBlock; ++i)
+        {
+            bcostars::Transaction transaction;
+            transaction.data.chainID = "chain0";
+            transaction.data.groupID = "group0";
+            transaction.data.nonce = std::to_string(i);
+            transaction.data.input.assign(mockConfig.transactionInputSize, (tars::Char)i);
+            transaction.dataHash.assign(32, (tars::Char)i);
+            transaction.signature.assign(65, (tars::Char)i);
+            block.transactions.emplace_back(std::move(transaction));
+        }
+        return block;
+    }
+
+    void initialize() override
+    {
+        auto const& mockConfig = config();
+        m_blockTemplate = makeBlockTemplate();
+        bcos::ledger::MerkleProof proof;
+        for (size_t level = 0; level < mockConfig.proofLevels; ++level)
+        {
+            auto sibling = bcos::toHex(bcos::bytes(32, (bcos::byte)level));
+            bcostars::MerkleProofItem item;
+            (level % 2 == 0 ? item.left : item.right).push_back(sibling);
+            proof.emplace_back(item.left, item.right);
+            m_proofTemplate.emplace_back(std::move(item));
+        }
+        m_proofBlobTemplate = bcostars::protocol::MerkleProofView::encode(proof);
+    }
+    void destroy() override {}
+
+    bcostars::Error asyncGetBlockDataByNumber(tars::Int64 _blockNumber, tars::Int64,
+        bcostars::Block& _block, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        if (_blockNumber > config().latestBlockNumber)
+        {
+            return notFound();
+        }
+        _block = makeBlock(_blockNumber);
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetBlockDataByRange(tars::Int64 _startNumber, tars::Int64 _count,
+        tars::Int64, vector<bcostars::Block>& _blocks, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        auto endNumber = std::min(_startNumber + _count, config().latestBlockNumber + 1);
+        for (auto number = _startNumber; number < endNumber; ++number)
+        {
+            _blocks.emplace_back(makeBlock(number));
+        }
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetBlockChunkByNumber(tars::Int64 _blockNumber, tars::Int64,
+        tars::Int64 _offset, tars::Int64 _chunkSize, bcostars::BlockChunk& _chunk,
+        tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        if (_blockNumber > config().latestBlockNumber)
+        {
+            return notFound();
+        }
+        // the block is encoded once for all the chunks of the transfer
+        auto chunker = chunkerCache().chunker(_blockNumber, [this, _blockNumber]() {
+            tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
+            makeBlock(_blockNumber).writeTo(output);
+            auto encodedBlock = std::make_shared<bcos::bytes>();
+            output.getByteBuffer().swap(*encodedBlock);
+            return std::shared_ptr<bcos::bytes const>(std::move(encodedBlock));
+        });
+        _chunk = chunker->chunkAt(_offset, std::max<tars::Int64>(_chunkSize, 1));
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetBlockNumber(tars::Int64& _blockNumber, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _blockNumber = config().latestBlockNumber;
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetBlockHashByNumber(
+        tars::Int64 _blockNumber, vector<tars::Char>& _blockHash, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _blockHash.assign(32, 0);
+        std::copy_n((tars::Char*)&_blockNumber, sizeof(_blockNumber), _blockHash.begin());
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetBlockNumberByHash(const vector<tars::Char>& _blockHash,
+        tars::Int64& _blockNumber, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _blockNumber = 0;
+        std::copy_n(_blockHash.begin(), std::min(_blockHash.size(), sizeof(_blockNumber)),
+            (tars::Char*)&_blockNumber);
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetBatchTxsByHashList(const vector<vector<tars::Char>>& _txsHashList,
+        tars::Bool _withProof, vector<bcostars::Transaction>& _transactions,
+        map<std::string, vector<bcostars::MerkleProofItem>>& _merkleProofList,
+        tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        for (size_t i = 0; i < _txsHashList.size(); ++i)
+        {
+            _transactions.emplace_back(
+                m_blockTemplate.transactions[i % m_blockTemplate.transactions.size()]);
+            if (_withProof)
+            {
+                _merkleProofList[bcos::toHex(_txsHashList[i])] = m_proofTemplate;
+            }
+        }
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetBatchTxsByHashListV2(const vector<vector<tars::Char>>& _txsHashList,
+        tars::Bool _withProof, vector<bcostars::Transaction>& _transactions,
+        map<std::string, bcostars::MerkleProofBlob>& _merkleProofList,
+        tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        for (size_t i = 0; i < _txsHashList.size(); ++i)
+        {
+            _transactions.emplace_back(
+                m_blockTemplate.transactions[i % m_blockTemplate.transactions.size()]);
+            if (_withProof)
+            {
+                _merkleProofList[bcos::toHex(_txsHashList[i])] = m_proofBlobTemplate;
+            }
+        }
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetBatchTxsByHashListAligned(
+        const vector<vector<tars::Char>>& _txsHashList, tars::Bool _withProof,
+        vector<bcostars::Transaction>& _transactions, vector<bcostars::MerkleProofBlob>& _proofs,
+        vector<tars::Char>& _foundBitmap, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        bcostars::protocol::resetPresenceBitmap(_foundBitmap, _txsHashList.size());
+        _transactions.reserve(_txsHashList.size());
+        for (size_t i = 0; i < _txsHashList.size(); ++i)
+        {
+            _transactions.emplace_back(
+                m_blockTemplate.transactions[i % m_blockTemplate.transactions.size()]);
+            bcostars::protocol::setPresent(_foundBitmap, i);
+        }
+        if (_withProof)
+        {
+            _proofs.assign(_txsHashList.size(), m_proofBlobTemplate);
+        }
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetTransactionReceiptByHash(const vector<tars::Char>&,
+        tars::Bool _withProof, bcostars::TransactionReceipt& _receipt,
+        vector<bcostars::MerkleProofItem>& _proof, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _receipt = makeReceipt();
+        if (_withProof)
+        {
+            _proof = m_proofTemplate;
+        }
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetTransactionReceiptByHashV2(const vector<tars::Char>&,
+        tars::Bool _withProof, bcostars::TransactionReceipt& _receipt,
+        bcostars::MerkleProofBlob& _proof, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _receipt = makeReceipt();
+        if (_withProof)
+        {
+            _proof = m_proofBlobTemplate;
+        }
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetTotalTransactionCount(tars::Int64& _totalTxCount,
+        tars::Int64& _failedTxCount, tars::Int64& _latestBlockNumber,
+        tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _latestBlockNumber = config().latestBlockNumber;
+        _totalTxCount = (_latestBlockNumber + 1) * config().transactionsPerBlock;
+        _failedTxCount = 0;
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetSystemConfigByKey(const std::string&, std::string& _value,
+        tars::Int64& _blockNumber, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _value = "1000";
+        _blockNumber = 0;
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetNodeListByType(
+        const std::string&, vector<bcostars::ConsensusNode>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+private:
+    static bcostars::Error notFound()
+    {
+        bcostars::Error error;
+        error.errorCode = -1;
+        error.errorMessage = "block not found";
+        return error;
+    }
+
+    bcostars::Block makeBlock(int64_t _blockNumber) const
+    {
+        auto block = m_blockTemplate;
+        block.blockHeader.data.blockNumber = _blockNumber;
+        return block;
+    }
+
+    static bcostars::TransactionReceipt makeReceipt()
+    {
+        bcostars::TransactionReceipt receipt;
+        receipt.data.gasUsed = "0";
+        receipt.data.blockNumber = config().latestBlockNumber;
+        return receipt;
+    }
+
+    bcostars::Block m_blockTemplate;
+    vector<bcostars::MerkleProofItem> m_proofTemplate;
+    bcostars::MerkleProofBlob m_proofBlobTemplate;
+};
+}  // namespace bench
+}  // namespace bcostars
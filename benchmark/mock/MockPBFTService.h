@@ -0,0 +1,112 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the stand-in consensus and block sync servant
+ * @file MockPBFTService.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "MockServant.h"
+#include "bcos-tars-protocol/tars/PBFTService.h"
+
+namespace bcostars
+{
+namespace bench
+{
+class MockPBFTService : public MockServant<bcostars::PBFTService>
+{
+public:
+    bcostars::Error asyncNotifyConsensusMessage(const std::string&, const vector<tars::Char>&,
+        const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncSubmitProposal(tars::Bool, const vector<tars::Char>&, tars::Int64,
+        const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetPBFTView(tars::Int64& _view, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _view = 1;
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncCheckBlock(
+        const bcostars::Block&, tars::Bool& _verifyResult, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _verifyResult = true;
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncCheckBlockChunk(
+        const bcostars::BlockChunk&, tars::Bool& _verifyResult, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _verifyResult = true;
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncNotifyNewBlock(
+        const bcostars::LedgerConfig&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncNotifyBlockSyncMessage(const std::string&, const vector<tars::Char>&,
+        const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncNoteUnSealedTxsSize(tars::Int64, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetSyncInfo(std::string& _syncInfo, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _syncInfo.assign(config().payloadSize, 's');
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetConsensusStatus(
+        std::string& _consensusStatus, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _consensusStatus.assign(config().payloadSize, 'c');
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncNotifyConnectedNodes(
+        const vector<vector<tars::Char>>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+};
+}  // namespace bench
+}  // namespace bcostars
@@ -0,0 +1,62 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the stand-in rpc servant
+ * @file MockRpcService.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "MockServant.h"
+#include "bcos-tars-protocol/tars/RpcService.h"
+
+namespace bcostars
+{
+namespace bench
+{
+class MockRpcService : public MockServant<bcostars::RpcService>
+{
+public:
+    bcostars::Error asyncNotifyBlockNumber(
+        const std::string&, const std::string&, tars::Int64, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncNotifyGroupInfo(
+        const bcostars::GroupInfo&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncNotifyAMOPMessage(tars::Int32, const std::string&,
+        const vector<tars::Char>&, vector<tars::Char>& _responseData,
+        tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _responseData = payload();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncNotifySubscribeTopic(tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+};
+}  // namespace bench
+}  // namespace bcostars
@@ -0,0 +1,49 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the stand-in scheduler servant answering with the generated receipts
+ * @file MockSchedulerService.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "MockServant.h"
+#include "bcos-tars-protocol/tars/SchedulerService.h"
+
+namespace bcostars
+{
+namespace bench
+{
+class MockSchedulerService : public MockServant<bcostars::SchedulerService>
+{
+public:
+    bcostars::Error call(const bcostars::Transaction&, bcostars::TransactionReceipt& _receipt,
+        tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _receipt = makeReceipt();
+        return bcostars::Error();
+    }
+
+    bcostars::Error getCode(
+        const std::string&, vector<tars::Char>& _code, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _code = payload();
+        return bcostars::Error();
+    }
+};
+}  // namespace bench
+}  // namespace bcostars
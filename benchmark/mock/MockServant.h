@@ -0,0 +1,104 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the common part of the stand-in servants
+ * @file MockServant.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "bcos-tars-protocol/tars/Transaction.h"
+#include "bcos-tars-protocol/tars/TransactionReceipt.h"
+#include <tarscpp/servant/Application.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bcostars
+{
+namespace bench
+{
+struct MockServiceConfig
+{
+    // the size of the byte payloads responded, e.g. the message data, the code or the tx input
+    size_t payloadSize = 256;
+    // the number of the items of the list responses, e.g. the node IDs or the peers
+    size_t listSize = 4;
+    // the processing time of every request
+    std::chrono::microseconds delay = std::chrono::microseconds(0);
+};
+
+// the servant of the tars interface ServantBase answering every request with the generated
+// payloads after the configured delay
+template <typename ServantBase>
+class MockServant : public ServantBase
+{
+public:
+    // Note: tars creates a servant for every handle thread, so the config is shared by the
+    // servants of the same interface
+    static MockServiceConfig& config()
+    {
+        static MockServiceConfig s_config;
+        return s_config;
+    }
+
+    void initialize() override {}
+    void destroy() override {}
+
+protected:
+    static void simulateDelay()
+    {
+        auto delay = config().delay;
+        if (delay.count() > 0)
+        {
+            std::this_thread::sleep_for(delay);
+        }
+    }
+
+    static vector<tars::Char> payload() { return vector<tars::Char>(config().payloadSize, 'p'); }
+
+    static vector<vector<tars::Char>> nodeIDList()
+    {
+        vector<vector<tars::Char>> nodeIDs;
+        for (size_t i = 0; i < config().listSize; ++i)
+        {
+            nodeIDs.emplace_back(64, (tars::Char)i);
+        }
+        return nodeIDs;
+    }
+
+    static bcostars::Transaction makeTransaction(size_t _index)
+    {
+        bcostars::Transaction transaction;
+        transaction.data.chainID = "chain0";
+        transaction.data.groupID = "group0";
+        transaction.data.nonce = std::to_string(_index);
+        transaction.data.input = payload();
+        transaction.dataHash.assign(32, (tars::Char)_index);
+        transaction.signature.assign(65, (tars::Char)_index);
+        return transaction;
+    }
+
+    static bcostars::TransactionReceipt makeReceipt()
+    {
+        bcostars::TransactionReceipt receipt;
+        receipt.data.gasUsed = "0";
+        receipt.data.output = payload();
+        return receipt;
+    }
+};
+}  // namespace bench
+}  // namespace bcostars
@@ -0,0 +1,130 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the stand-in txpool servant answering with the generated transactions
+ * @file MockTxPoolService.h
+ * @author: agent
+ * @date 2026-10-19
+ */
+#pragma once
+#include "MockServant.h"
+#include <algorithm>
+#include "bcos-tars-protocol/tars/TxPoolService.h"
+
+namespace bcostars
+{
+namespace bench
+{
+class MockTxPoolService : public MockServant<bcostars::TxPoolService>
+{
+public:
+    bcostars::Error asyncSubmit(const vector<tars::Char>& _tx,
+        bcostars::TransactionSubmitResult& _result, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _result.txHash.assign(32, _tx.empty() ? 0 : _tx[0]);
+        _result.transactionReceipt = makeReceipt();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncSealTxs(tars::Int64 _txsLimit, const vector<vector<tars::Char>>&,
+        bcostars::Block& _txsList, bcostars::Block&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        for (tars::Int64 i = 0; i < std::min<tars::Int64>(_txsLimit, config().listSize); ++i)
+        {
+            _txsList.transactionsMetaData.emplace_back();
+            _txsList.transactionsMetaData.back().hash.assign(32, (tars::Char)i);
+        }
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncMarkTxs(const vector<vector<tars::Char>>&, tars::Bool, tars::Int64,
+        const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncVerifyBlock(const vector<tars::Char>&, const vector<tars::Char>&,
+        tars::Bool& _result, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _result = true;
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncFillBlock(const vector<vector<tars::Char>>& _txHashs,
+        vector<bcostars::Transaction>& _filled, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        for (size_t i = 0; i < _txHashs.size(); ++i)
+        {
+            _filled.emplace_back(makeTransaction(i));
+        }
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncNotifyBlockResult(tars::Int64,
+        const vector<bcostars::TransactionSubmitResult>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncNotifyTxsSyncMessage(const bcostars::Error&, const std::string&,
+        const vector<tars::Char>&, const vector<tars::Char>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error notifyConnectedNodes(
+        const vector<vector<tars::Char>>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error notifyConsensusNodeList(
+        const vector<bcostars::ConsensusNode>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error notifyObserverNodeList(
+        const vector<bcostars::ConsensusNode>&, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncResetTxPool(tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        return bcostars::Error();
+    }
+
+    bcostars::Error asyncGetPendingTransactionSize(
+        tars::Int64& _txsSize, tars::TarsCurrentPtr) override
+    {
+        simulateDelay();
+        _txsSize = config().listSize;
+        return bcostars::Error();
+    }
+};
+}  // namespace bench
+}  // namespace bcostars
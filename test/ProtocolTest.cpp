@@ -1,9 +1,18 @@
+#include "bcos-tars-protocol/AllocationTracker.h"
+#include "bcos-tars-protocol/protocol/BlockChunk.h"
 #include "bcos-tars-protocol/protocol/BlockFactoryImpl.h"
 #include "bcos-tars-protocol/protocol/BlockHeaderFactoryImpl.h"
+#include "bcos-tars-protocol/protocol/DecimalCodec.h"
+#include "bcos-tars-protocol/protocol/HashField.h"
+#include "bcos-tars-protocol/protocol/LazyValue.h"
+#include "bcos-tars-protocol/protocol/MerkleProofView.h"
+#include "bcos-tars-protocol/protocol/NonceCodec.h"
+#include "bcos-tars-protocol/protocol/PresenceBitmap.h"
 #include "bcos-tars-protocol/protocol/TransactionFactoryImpl.h"
 #include "bcos-tars-protocol/protocol/TransactionMetaDataImpl.h"
 #include "bcos-tars-protocol/protocol/TransactionReceiptFactoryImpl.h"
 #include "bcos-tars-protocol/protocol/TransactionSubmitResultImpl.h"
+#include "bcos-tars-protocol/protocol/WireCodec.h"
 #include "bcos-tars-protocol/tars/Block.h"
 #include <bcos-framework/interfaces/crypto/CommonType.h>
 #include <bcos-framework/interfaces/crypto/CryptoSuite.h>
@@ -17,7 +26,11 @@
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
 #include <gsl/span>
+#include <atomic>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <random>
 
 namespace bcostars
 {
@@ -415,6 +428,147 @@ BOOST_AUTO_TEST_CASE(block)
     }
 }
 
+BOOST_AUTO_TEST_CASE(blockChunk)
+{
+    auto block = blockFactory->createBlock();
+    block->blockHeader()->setNumber(100);
+    bcos::bytes input(bcos::asBytes("Arguments"));
+    for (size_t i = 0; i < 100; ++i)
+    {
+        block->appendTransaction(transactionFactory->createTransaction(
+            117, "Target", input, bcos::u256(i), i, "testChain", "testGroup", 1000));
+    }
+    bcos::bytes encodedBlock;
+    block->encode(encodedBlock);
+
+    protocol::BlockChunker chunker(block, 1, 1000);
+    BOOST_CHECK_EQUAL(chunker.totalSize(), encodedBlock.size());
+    BOOST_CHECK_EQUAL(chunker.chunkCount(), (encodedBlock.size() + 999) / 1000);
+    BOOST_CHECK_EQUAL(chunker.chunk(chunker.chunkCount() - 1).data.size(),
+        encodedBlock.size() - (chunker.chunkCount() - 1) * 1000);
+
+    // assemble the chunks in the reverse order
+    protocol::BlockAssembler assembler(1, chunker.totalSize());
+    for (size_t i = chunker.chunkCount(); i > 0; --i)
+    {
+        BOOST_CHECK(!assembler.complete());
+        BOOST_CHECK(assembler.append(chunker.chunk(i - 1)));
+    }
+    BOOST_CHECK(assembler.complete());
+    BOOST_CHECK_EQUAL(assembler.receivedSize(), chunker.totalSize());
+
+    auto decodedBlock = assembler.decode(*blockFactory);
+    BOOST_CHECK_EQUAL(decodedBlock->blockHeaderConst()->number(), 100);
+    BOOST_CHECK_EQUAL(decodedBlock->transactionsSize(), 100);
+    bcos::bytes reencodedBlock;
+    decodedBlock->encode(reencodedBlock);
+    BOOST_CHECK(reencodedBlock == encodedBlock);
+
+    // the duplicated, overlapping, out of range chunks and the chunks of other transfers
+    protocol::BlockAssembler partialAssembler(1, chunker.totalSize());
+    BOOST_CHECK(partialAssembler.append(chunker.chunkAt(1000, 1000)));
+    BOOST_CHECK(!partialAssembler.append(chunker.chunk(1)));
+    BOOST_CHECK(!partialAssembler.append(chunker.chunkAt(500, 1000)));
+    BOOST_CHECK(!partialAssembler.append(chunker.chunkAt(1500, 1000)));
+    BOOST_CHECK(partialAssembler.append(chunker.chunkAt(0, 1000)));
+    auto outOfRange = chunker.chunk(0);
+    outOfRange.offset = chunker.totalSize();
+    BOOST_CHECK(!partialAssembler.append(outOfRange));
+    protocol::BlockChunker otherChunker(block, 2, 1000);
+    BOOST_CHECK(!partialAssembler.append(otherChunker.chunk(2)));
+    BOOST_CHECK_EQUAL(partialAssembler.receivedSize(), 2000);
+    BOOST_CHECK_THROW(partialAssembler.decode(*blockFactory), std::exception);
+
+    // the total size from the peer is checked before the buffer is allocated
+    BOOST_CHECK(protocol::BlockAssembler::create(1, chunker.totalSize()));
+    BOOST_CHECK(!protocol::BlockAssembler::create(1, 0));
+    BOOST_CHECK(!protocol::BlockAssembler::create(1, -1));
+    BOOST_CHECK(!protocol::BlockAssembler::create(1, chunker.totalSize(), chunker.totalSize() - 1));
+    BOOST_CHECK(!protocol::BlockAssembler::create(1, std::numeric_limits<int64_t>::max()));
+
+    // the servant encodes the block once per transfer
+    protocol::BlockChunkerCache chunkerCache(2);
+    size_t encodedCount = 0;
+    auto encode = [&encodedCount, &encodedBlock]() {
+        ++encodedCount;
+        return std::make_shared<bcos::bytes const>(encodedBlock);
+    };
+    for (size_t i = 0; i < chunker.chunkCount(); ++i)
+    {
+        auto cachedChunker = chunkerCache.chunker(1, encode, 1000);
+        BOOST_CHECK(cachedChunker->chunk(i).data == chunker.chunk(i).data);
+    }
+    BOOST_CHECK_EQUAL(encodedCount, 1);
+    chunkerCache.chunker(2, encode, 1000);
+    chunkerCache.chunker(1, encode, 1000);
+    BOOST_CHECK_EQUAL(encodedCount, 2);
+    // the least recently used transfer is evicted
+    chunkerCache.chunker(3, encode, 1000);
+    chunkerCache.chunker(1, encode, 1000);
+    BOOST_CHECK_EQUAL(encodedCount, 3);
+    chunkerCache.chunker(2, encode, 1000);
+    BOOST_CHECK_EQUAL(encodedCount, 4);
+}
+
+BOOST_AUTO_TEST_CASE(merkleProofView)
+{
+    bcos::ledger::MerkleProof proof;
+    for (size_t level = 0; level < 5; ++level)
+    {
+        std::vector<std::string> leftSiblings;
+        for (size_t i = 0; i < level % 3; ++i)
+        {
+            leftSiblings.emplace_back(bcos::toHex(bcos::bytes(32, (bcos::byte)(level * 10 + i))));
+        }
+        std::vector<std::string> rightSiblings{bcos::toHex(bcos::bytes(32, (bcos::byte)level))};
+        proof.emplace_back(leftSiblings, rightSiblings);
+    }
+    auto blob = protocol::MerkleProofView::encode(proof);
+    BOOST_CHECK_EQUAL(blob.hashSize, 32);
+    BOOST_CHECK_EQUAL(blob.hashes.size(), 8 * 32);
+
+    protocol::MerkleProofView view(std::move(blob));
+    BOOST_CHECK(view.valid());
+    BOOST_CHECK_EQUAL(view.levels(), 5);
+    BOOST_CHECK_EQUAL(view.leftSize(2), 2);
+    BOOST_CHECK_EQUAL(view.rightSize(2), 1);
+    BOOST_CHECK_EQUAL(view.left(2, 1).size(), 32);
+    BOOST_CHECK_EQUAL(view.left(2, 1)[0], 21);
+    BOOST_CHECK_EQUAL(view.right(4, 0)[31], 4);
+    BOOST_CHECK(*view.toMerkleProof() == proof);
+
+    protocol::MerkleProofView emptyView;
+    BOOST_CHECK(emptyView.valid());
+    BOOST_CHECK_EQUAL(emptyView.levels(), 0);
+
+    auto decreasingOffsets = view.inner();
+    decreasingOffsets.siblingOffsets[3] = 0;
+    BOOST_CHECK(!protocol::MerkleProofView(std::move(decreasingOffsets)).valid());
+    auto truncatedHashes = view.inner();
+    truncatedHashes.hashes.pop_back();
+    BOOST_CHECK(!protocol::MerkleProofView(std::move(truncatedHashes)).valid());
+
+    bcos::ledger::MerkleProof mixedSizes{{{"aa"}, {"bbbb"}}};
+    BOOST_CHECK_THROW(protocol::MerkleProofView::encode(mixedSizes), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(presenceBitmap)
+{
+    std::vector<tars::Char> bitmap;
+    protocol::resetPresenceBitmap(bitmap, 17);
+    BOOST_CHECK_EQUAL(bitmap.size(), 3);
+    for (size_t i : {0, 7, 8, 16})
+    {
+        protocol::setPresent(bitmap, i);
+    }
+    for (size_t i = 0; i < 17; ++i)
+    {
+        BOOST_CHECK_EQUAL(protocol::isPresent(bitmap, i), i == 0 || i == 7 || i == 8 || i == 16);
+    }
+    BOOST_CHECK(!protocol::isPresent(bitmap, 24));
+    BOOST_CHECK_EQUAL((uint8_t)bitmap[0], 0x81);
+}
+
 BOOST_AUTO_TEST_CASE(blockHeader)
 {
     auto header = blockHeaderFactory->createBlockHeader();
@@ -496,6 +650,649 @@ BOOST_AUTO_TEST_CASE(tarsMovable)
     BOOST_CHECK_EQUAL((intptr_t)tx1.data.input.data(), (intptr_t) nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(binaryNonce)
+{
+    std::vector<bcos::u256> nonces = {0, 1, 255, bcos::u256(1) << 64,
+        (bcos::u256(1) << 255) + 12345, ~bcos::u256(0),
+        boost::lexical_cast<bcos::u256>("123456789012345678901234567890")};
+    for (auto const& nonce : nonces)
+    {
+        bcos::bytes encoded(protocol::c_binaryNonceSize);
+        protocol::encodeBinaryNonce(nonce, encoded.data());
+        BOOST_CHECK_EQUAL(protocol::decodeBinaryNonce(encoded.data()), nonce);
+        bcos::u256 bigEndian = 0;
+        for (auto byte : encoded)
+        {
+            bigEndian = (bigEndian << 8) | byte;
+        }
+        BOOST_CHECK_EQUAL(bigEndian, nonce);
+    }
+
+    // the transactions since the version carry the binary nonce
+    auto keyPair = cryptoSuite->signatureImpl()->generateKeyPair();
+    auto nonce = nonces[4];
+    auto tx = transactionFactory->createTransaction(protocol::c_binaryNonceVersion, "Target",
+        bcos::asBytes("Arguments"), nonce, 100, "testChain", "testGroup", 1000, keyPair);
+    auto const& inner = std::dynamic_pointer_cast<protocol::TransactionImpl>(tx)->inner();
+    BOOST_CHECK(inner.data.nonce.empty());
+    BOOST_CHECK_EQUAL(inner.data.nonceBytes.size(), protocol::c_binaryNonceSize);
+    auto decodedTx = transactionFactory->createTransaction(tx->encode(false), true);
+    BOOST_CHECK_EQUAL(decodedTx->nonce(), nonce);
+    BOOST_CHECK_EQUAL(decodedTx->hash(), tx->hash());
+    auto legacyTx = transactionFactory->createTransaction(0, "Target",
+        bcos::asBytes("Arguments"), nonce, 100, "testChain", "testGroup", 1000, keyPair);
+    BOOST_CHECK_EQUAL(legacyTx->nonce(), nonce);
+
+    // so do the nonce lists of the blocks
+    for (auto version : {0, protocol::c_binaryNonceVersion})
+    {
+        auto block = blockFactory->createBlock();
+        block->setVersion(version);
+        block->setNonceList(bcos::protocol::NonceList(nonces));
+        auto const& blockInner = std::dynamic_pointer_cast<protocol::BlockImpl>(block)->inner();
+        BOOST_CHECK_EQUAL(blockInner.nonceListBytes.empty(), version == 0);
+        BOOST_CHECK_EQUAL(blockInner.nonceList.empty(), version != 0);
+
+        bcos::bytes buffer;
+        block->encode(buffer);
+        auto decodedBlock = blockFactory->createBlock(buffer);
+        BOOST_CHECK(decodedBlock->nonceList() == nonces);
+    }
+
+    // the nonce list set before the version follows it
+    auto block = blockFactory->createBlock();
+    block->setNonceList(bcos::protocol::NonceList(nonces));
+    block->setVersion(protocol::c_binaryNonceVersion);
+    auto blockImpl = std::dynamic_pointer_cast<protocol::BlockImpl>(block);
+    BOOST_CHECK(blockImpl->inner().nonceList.empty());
+    BOOST_CHECK_EQUAL(
+        blockImpl->inner().nonceListBytes.size(), nonces.size() * protocol::c_binaryNonceSize);
+    BOOST_CHECK(block->nonceList() == nonces);
+    auto header = blockHeaderFactory->createBlockHeader();
+    header->setVersion(0);
+    block->setBlockHeader(header);
+    BOOST_CHECK(blockImpl->inner().nonceListBytes.empty());
+    BOOST_CHECK_EQUAL(blockImpl->inner().nonceList.size(), nonces.size());
+    bcos::bytes buffer;
+    block->encode(buffer);
+    BOOST_CHECK(blockFactory->createBlock(buffer)->nonceList() == nonces);
+
+    // the binary nonce list of a partial nonce is rejected
+    auto badInner = blockImpl->inner();
+    badInner.nonceList.clear();
+    badInner.nonceListBytes.resize(protocol::c_binaryNonceSize + 1);
+    auto badBlock = blockFactory->createBlock();
+    std::dynamic_pointer_cast<protocol::BlockImpl>(badBlock)->setInner(std::move(badInner));
+    BOOST_CHECK_THROW(badBlock->nonceList(), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(decimalCodec)
+{
+    auto lexicalParse = [](std::string const& _text) {
+        try
+        {
+            return std::optional<bcos::u256>(boost::lexical_cast<bcos::u256>(_text));
+        }
+        catch (std::exception const&)
+        {
+            return std::optional<bcos::u256>();
+        }
+    };
+    auto parse = [](std::string const& _text) {
+        try
+        {
+            return std::optional<bcos::u256>(protocol::parseDecimalU256(_text));
+        }
+        catch (std::exception const&)
+        {
+            return std::optional<bcos::u256>();
+        }
+    };
+
+    std::mt19937_64 random(2021);
+    for (int i = 0; i < 10000; ++i)
+    {
+        std::string text(1 + random() % 78, '0');
+        for (auto& digit : text)
+        {
+            digit = (char)('0' + random() % 10);
+        }
+        BOOST_CHECK(parse(text) == lexicalParse(text));
+
+        bcos::u256 value = 0;
+        for (int j = 0; j < 4; ++j)
+        {
+            value = (value << 64) | random();
+        }
+        value >>= random() % 256;
+        BOOST_CHECK_EQUAL(
+            protocol::formatDecimalU256(value), boost::lexical_cast<std::string>(value));
+    }
+
+    // the max u256, the wrapped around, the octal, the hex and the bad ones
+    for (std::string text : {"0", "00", "9999999999999999999", "10000000000000000000",
+             "115792089237316195423570985008687907853269984665640564039457584007913129639935",
+             "115792089237316195423570985008687907853269984665640564039457584007913129639936",
+             "0123", "0x1f", "", "12a", " 1", "-1"})
+    {
+        BOOST_CHECK(parse(text) == lexicalParse(text));
+    }
+    BOOST_CHECK_THROW(protocol::parseDecimalU256("12a"), std::exception);
+    BOOST_CHECK_EQUAL(protocol::formatDecimalU256(0), "0");
+    BOOST_CHECK_EQUAL(protocol::formatDecimalU256(~bcos::u256(0)),
+        "115792089237316195423570985008687907853269984665640564039457584007913129639935");
+}
+
+BOOST_AUTO_TEST_CASE(lazyValue)
+{
+    protocol::LazyValue<std::vector<int>> value;
+    std::atomic<int> decodes = 0;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, 64), [&](tbb::blocked_range<size_t> const&) {
+        auto const& decoded = value.get([&decodes]() {
+            ++decodes;
+            return std::vector<int>(100, 1);
+        });
+        BOOST_CHECK_EQUAL(decoded.size(), 100);
+    });
+    BOOST_CHECK_EQUAL(decodes.load(), 1);
+
+    // the failed decode is retried by the next reader
+    protocol::LazyValue<int> failed;
+    BOOST_CHECK_THROW(
+        failed.get([]() -> int { BOOST_THROW_EXCEPTION(std::runtime_error("bad")); }),
+        std::runtime_error);
+    BOOST_CHECK(!failed.ready());
+    BOOST_CHECK_EQUAL(failed.get([]() { return 7; }), 7);
+    failed.reset();
+    BOOST_CHECK_EQUAL(failed.get([]() { return 8; }), 8);
+
+    // the decoded fields of the shared block are read by the parallel executors
+    auto block = blockFactory->createBlock();
+    bcos::protocol::NonceList nonces;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        nonces.push_back(bcos::u256(i) << 100);
+    }
+    block->setNonceList(nonces);
+    bcos::bytes buffer;
+    block->encode(buffer);
+    auto decodedBlock = blockFactory->createBlock(buffer);
+    auto transaction = transactionFactory->createTransaction(0, "Target",
+        bcos::asBytes("Arguments"), nonces[3], 100, "testChain", "testGroup", 1000,
+        cryptoSuite->signatureImpl()->generateKeyPair());
+    auto decodedTransaction = transactionFactory->createTransaction(transaction->encode(), true);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, 64), [&](tbb::blocked_range<size_t> const&) {
+        BOOST_CHECK(decodedBlock->nonceList() == nonces);
+        BOOST_CHECK_EQUAL(decodedTransaction->nonce(), nonces[3]);
+    });
+    BOOST_CHECK_EQUAL(&decodedBlock->nonceList(), &decodedBlock->nonceList());
+}
+
+BOOST_AUTO_TEST_CASE(hashField)
+{
+    auto hash = bcos::crypto::HashType(bcos::asBytes("hash field"));
+    std::vector<tars::Char> field;
+    BOOST_CHECK_EQUAL(protocol::hashFromField(field), bcos::crypto::HashType());
+    protocol::assignHash(field, hash);
+    BOOST_CHECK_EQUAL(field.size(), bcos::crypto::HashType::size);
+    BOOST_CHECK_EQUAL(protocol::hashFromField(field), hash);
+
+    // the malformed fields are read as the zero hash rather than past their end
+    field.resize(20);
+    BOOST_CHECK_EQUAL(protocol::hashFromField(field), bcos::crypto::HashType());
+    auto header = blockHeaderFactory->createBlockHeader();
+    auto headerImpl = std::dynamic_pointer_cast<protocol::BlockHeaderImpl>(header);
+    auto inner = headerImpl->inner();
+    inner.data.txsRoot.assign(4, 'r');
+    headerImpl->setInner(std::move(inner));
+    BOOST_CHECK_EQUAL(header->txsRoot(), bcos::crypto::HashType());
+    header->setTxsRoot(hash);
+    BOOST_CHECK_EQUAL(header->txsRoot(), hash);
+}
+
+template <class TarsStruct>
+bcos::bytes encodeStruct(TarsStruct const& _value)
+{
+    tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
+    _value.writeTo(output);
+    bcos::bytes buffer;
+    output.getByteBuffer().swap(buffer);
+    return buffer;
+}
+
+// the hand-written reader against the generated readFrom on the valid and the mutated encodings
+template <class TarsStruct, class TryRead, class Read>
+void checkWireReader(bcos::bytes const& _encoded, TryRead _tryRead, Read _read, std::mt19937& _rng)
+{
+    TarsStruct fast;
+    BOOST_CHECK(_tryRead(bcos::ref(_encoded), fast));
+    BOOST_CHECK(encodeStruct(fast) == _encoded);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        auto mutated = _encoded;
+        auto mutations = 1 + _rng() % 4;
+        for (size_t j = 0; j < mutations && !mutated.empty(); ++j)
+        {
+            switch (_rng() % 3)
+            {
+            case 0:
+                mutated[_rng() % mutated.size()] = bcos::byte(_rng());
+                break;
+            case 1:
+                mutated.resize(_rng() % mutated.size());
+                break;
+            default:
+                mutated.insert(mutated.begin() + _rng() % mutated.size(), bcos::byte(_rng()));
+                break;
+            }
+        }
+
+        std::optional<bcos::bytes> expected;
+        try
+        {
+            TarsStruct generic;
+            tars::TarsInputStream<tars::BufferReader> input;
+            input.setBuffer((const char*)mutated.data(), mutated.size());
+            generic.readFrom(input);
+            expected = encodeStruct(generic);
+        }
+        catch (std::exception const&)
+        {}
+
+        TarsStruct tried;
+        if (_tryRead(bcos::ref(mutated), tried))
+        {
+            BOOST_REQUIRE(expected);
+            BOOST_CHECK(encodeStruct(tried) == *expected);
+        }
+
+        std::optional<bcos::bytes> actual;
+        try
+        {
+            TarsStruct read;
+            _read(bcos::ref(mutated), read);
+            actual = encodeStruct(read);
+        }
+        catch (std::exception const&)
+        {}
+        BOOST_CHECK(actual == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(wireCodec)
+{
+    std::mt19937 rng(47);
+
+    auto tx = transactionFactory->createTransaction(0, "Target", bcos::asBytes("Arguments"), 800,
+        100, "testChain", "testGroup", 1000, cryptoSuite->signatureImpl()->generateKeyPair());
+    tx->verify();
+    BOOST_CHECK(!tx->sender().empty());
+    auto txBuffer = tx->encode(false);
+    checkWireReader<bcostars::Transaction>(bcos::bytes(txBuffer.begin(), txBuffer.end()),
+        protocol::tryReadTransaction, protocol::readTransaction, rng);
+
+    auto logEntries = std::make_shared<std::vector<bcos::protocol::LogEntry>>();
+    for (auto i : {1, 2})
+    {
+        bcos::h256s topics{bcos::h256(i), bcos::h256(i * 10)};
+        logEntries->emplace_back(bcos::asBytes("Address"), topics, bcos::asBytes("Data"));
+    }
+    auto receipt = transactionReceiptFactory->createReceipt(
+        8858, "contract", logEntries, 50, bcos::asBytes("Output!"), 888);
+    bcos::bytes receiptBuffer;
+    receipt->encode(receiptBuffer);
+    checkWireReader<bcostars::TransactionReceipt>(receiptBuffer,
+        protocol::tryReadTransactionReceipt, protocol::readTransactionReceipt, rng);
+
+    auto header = blockHeaderFactory->createBlockHeader();
+    header->setNumber(100);
+    header->setGasUsed(3000);
+    header->setTimestamp(1000);
+    header->setTxsRoot(bcos::crypto::HashType(bcos::asBytes("txs root")));
+    header->setStateRoot(bcos::crypto::HashType(bcos::asBytes("state root")));
+    bcos::protocol::ParentInfo parentInfo;
+    parentInfo.blockNumber = 99;
+    parentInfo.blockHash = bcos::crypto::HashType(99);
+    header->setParentInfo(std::vector<bcos::protocol::ParentInfo>{parentInfo});
+    std::vector<bcos::bytes> sealerList{bcos::asBytes("sealer0"), bcos::asBytes("sealer1")};
+    header->setSealerList(gsl::span<const bytes>(sealerList));
+    bcos::protocol::Signature signature;
+    signature.index = 0;
+    signature.signature = bcos::asBytes("signature");
+    header->setSignatureList(std::vector<bcos::protocol::Signature>{signature});
+    bcos::bytes headerBuffer;
+    header->encode(headerBuffer);
+    checkWireReader<bcostars::BlockHeader>(
+        headerBuffer, protocol::tryReadBlockHeader, protocol::readBlockHeader, rng);
+
+    auto decodedHeader = blockHeaderFactory->createBlockHeader(headerBuffer);
+    BOOST_CHECK_EQUAL(decodedHeader->hash(), header->hash());
+    BOOST_CHECK_EQUAL(decodedHeader->parentInfo()[0].blockNumber, 99);
+    BOOST_CHECK_EQUAL(decodedHeader->signatureList().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(lazyBlock)
+{
+    auto block = blockFactory->createBlock();
+    block->setVersion(1);
+    block->blockHeader()->setNumber(100);
+    bcos::protocol::NonceList nonces;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        auto transaction = transactionFactory->createTransaction(
+            0, "Target", bcos::asBytes("Arguments"), i, 100, "testChain", "testGroup", 1000);
+        block->appendTransaction(transaction);
+        block->appendTransactionMetaData(blockFactory->createTransactionMetaData(
+            transaction->hash(), transaction->hash().abridged()));
+        block->appendReceipt(transactionReceiptFactory->createReceipt(
+            i, "contract", std::make_shared<std::vector<bcos::protocol::LogEntry>>(), 0,
+            bcos::bytes(), 100));
+        nonces.push_back(i);
+    }
+    block->setNonceList(nonces);
+    auto encoded = std::make_shared<bcos::bytes>();
+    block->encode(*encoded);
+
+    auto eagerBlock = blockFactory->createBlock(*encoded);
+    auto lazyBlock = blockFactory->createBlockLazily(encoded);
+    BOOST_CHECK_EQUAL(lazyBlock->blockHeaderConst()->number(), 100);
+    BOOST_CHECK_EQUAL(lazyBlock->transactionsSize(), 100);
+    BOOST_CHECK_EQUAL(lazyBlock->receiptsSize(), 100);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, 100), [&](auto const& _range) {
+        for (auto i = _range.begin(); i < _range.end(); ++i)
+        {
+            auto transaction = lazyBlock->transaction(i);
+            BOOST_CHECK_EQUAL(transaction->hash(), eagerBlock->transaction(i)->hash());
+            BOOST_CHECK_EQUAL(lazyBlock->receipt(i)->hash(), eagerBlock->receipt(i)->hash());
+        }
+    });
+    BOOST_CHECK_THROW(lazyBlock->transaction(100), std::out_of_range);
+
+    // the received data of the elements is hashed where it is in the encoded block
+    auto inEncoded = [&](bcos::bytesConstRef _data) {
+        return _data.data() >= encoded->data() &&
+               _data.data() + _data.size() <= encoded->data() + encoded->size();
+    };
+    BOOST_CHECK(inEncoded(lazyBlock->transaction(5)->encode(true)));
+    BOOST_CHECK_EQUAL(
+        lazyBlock->blockHeaderConst()->hash(), eagerBlock->blockHeaderConst()->hash());
+    BOOST_CHECK(lazyBlock->nonceList() == nonces);
+    BOOST_CHECK_EQUAL(lazyBlock->transactionsMetaDataSize(), 100);
+    BOOST_CHECK_EQUAL(lazyBlock->transactionMetaData(99)->hash(), block->transaction(99)->hash());
+
+    bcos::bytes reencoded;
+    lazyBlock->encode(reencoded);
+    BOOST_CHECK(reencoded == *encoded);
+    lazyBlock->appendTransaction(transactionFactory->createTransaction(
+        0, "Target", bcos::asBytes("Arguments"), 100, 100, "testChain", "testGroup", 1000));
+    BOOST_CHECK_EQUAL(lazyBlock->transactionsSize(), 101);
+    BOOST_CHECK_EQUAL(lazyBlock->transaction(0)->hash(), eagerBlock->transaction(0)->hash());
+    BOOST_CHECK(!inEncoded(lazyBlock->transaction(5)->encode(true)));
+
+    // the header got before the header is modified through blockHeader() hashes the new data
+    auto modifiedBlock = blockFactory->createBlockLazily(encoded);
+    auto constHeader = modifiedBlock->blockHeaderConst();
+    modifiedBlock->blockHeader()->setNumber(101);
+    auto modifiedEagerBlock = blockFactory->createBlock(*encoded);
+    modifiedEagerBlock->blockHeader()->setNumber(101);
+    BOOST_CHECK_EQUAL(constHeader->number(), 101);
+    BOOST_CHECK_EQUAL(constHeader->hash(), modifiedEagerBlock->blockHeaderConst()->hash());
+    BOOST_CHECK(constHeader->hash() != eagerBlock->blockHeaderConst()->hash());
+
+    // so does the transaction got from the list of the materialized block before it is replaced
+    bcos::bytes materialized;
+    modifiedBlock->encode(materialized);
+    auto replacedTransaction = modifiedBlock->transaction(5);
+    BOOST_CHECK(inEncoded(replacedTransaction->encode(true)));
+    auto newTransaction = transactionFactory->createTransaction(
+        0, "Target", bcos::asBytes("Arguments"), 500, 100, "testChain", "testGroup", 1000);
+    modifiedBlock->setTransaction(5, newTransaction);
+    BOOST_CHECK(!inEncoded(replacedTransaction->encode(true)));
+    BOOST_CHECK_EQUAL(replacedTransaction->hash(), modifiedBlock->transaction(5)->hash());
+
+    // the mutated blocks, e.g. of the unknown layouts, decode as the eager ones or throw as them
+    std::mt19937 rng(48);
+    for (int i = 0; i < 500; ++i)
+    {
+        auto mutated = std::make_shared<bcos::bytes>(*encoded);
+        (*mutated)[rng() % mutated->size()] = bcos::byte(rng());
+        std::optional<bcos::bytes> expected;
+        try
+        {
+            blockFactory->createBlock(*mutated)->encode(expected.emplace());
+        }
+        catch (std::exception const&)
+        {
+            expected.reset();
+        }
+        std::optional<bcos::bytes> actual;
+        try
+        {
+            blockFactory->createBlockLazily(mutated)->encode(actual.emplace());
+        }
+        catch (std::exception const&)
+        {
+            actual.reset();
+        }
+        BOOST_CHECK(actual == expected);
+    }
+
+    // a field the lists don't expect, e.g. a second tag 3 before them, is decoded by readFrom,
+    // and the elements are still not in the lists of the block, which reallocate on appending
+    auto headerOnly = blockFactory->createBlock();
+    headerOnly->setVersion(1);
+    headerOnly->blockHeader()->setNumber(100);
+    bcos::bytes prefix;
+    headerOnly->encode(prefix);
+    BOOST_REQUIRE(std::equal(prefix.begin(), prefix.end(), encoded->begin()));
+    auto unusual = std::make_shared<bcos::bytes>(*encoded);
+    unusual->insert(unusual->begin() + prefix.size(), bcos::byte(0x3C));
+    auto unusualInner = std::make_shared<bcostars::Block>();
+    auto unusualBlock = protocol::LazyBlock::open(unusual, unusualInner);
+    BOOST_REQUIRE(unusualBlock);
+    BOOST_CHECK(!unusualBlock->lazy());
+    auto unusualTransaction = unusualBlock->transaction(1);
+    BOOST_CHECK(unusualTransaction != unusualBlock->transaction(0));
+    BOOST_CHECK_EQUAL(unusualTransaction, unusualBlock->transaction(1));
+    BOOST_CHECK(unusualTransaction.get() != &unusualInner->transactions[1]);
+    unusualInner->transactions.resize(1000);
+    auto const& eagerInner = std::dynamic_pointer_cast<protocol::BlockImpl>(eagerBlock)->inner();
+    BOOST_CHECK_EQUAL(unusualTransaction->data.nonce, eagerInner.transactions[1].data.nonce);
+}
+
+BOOST_AUTO_TEST_CASE(transactionPrecheck)
+{
+    for (auto version : {0, 1})
+    {
+        bcos::u256 nonce("123456789012345678901234567890");
+        auto tx = transactionFactory->createTransaction(version, "Target",
+            bcos::bytes(4096, 'i'), nonce, 100, "testChain", "testGroup", 1000,
+            cryptoSuite->signatureImpl()->generateKeyPair());
+        auto encoded = tx->encode(false);
+        auto precheck = transactionFactory->precheckTransaction(encoded);
+        BOOST_REQUIRE(precheck);
+        BOOST_CHECK_EQUAL(precheck->version, version);
+        BOOST_CHECK_EQUAL(precheck->chainID, "testChain");
+        BOOST_CHECK_EQUAL(precheck->groupID, "testGroup");
+        BOOST_CHECK_EQUAL(precheck->blockLimit, 100);
+        BOOST_CHECK_EQUAL(precheck->nonce, nonce);
+        BOOST_CHECK_EQUAL(precheck->hash, tx->hash());
+        // the views refer to the encoded transaction
+        auto data = precheck->data;
+        BOOST_CHECK(data.data() > encoded.data());
+        BOOST_CHECK(data.data() + data.size() < encoded.data() + encoded.size());
+    }
+
+    auto tx = transactionFactory->createTransaction(0, "Target", bcos::asBytes("Arguments"), 800,
+        100, "testChain", "testGroup", 1000, cryptoSuite->signatureImpl()->generateKeyPair());
+    bcos::bytes encoded = tx->encode(false).toBytes();
+
+    // the version 0 written as a Char instead of the ZeroTag decodes the same, but the hash of the
+    // encoded data differs
+    BOOST_REQUIRE_EQUAL(encoded[1], 0x1C);
+    auto nonCanonical = encoded;
+    nonCanonical[1] = 0x10;
+    nonCanonical.insert(nonCanonical.begin() + 2, 0);
+    protocol::TransactionPrecheck precheck;
+    BOOST_CHECK(protocol::readTransactionPrecheck(bcos::ref(nonCanonical), precheck));
+    BOOST_CHECK(!precheck.canonical);
+    BOOST_CHECK(!transactionFactory->precheckTransaction(bcos::ref(nonCanonical)));
+    BOOST_CHECK_EQUAL(transactionFactory->createTransaction(nonCanonical, false)->version(), 0);
+
+    // the carried data hash is taken by the decoded transactions
+    auto inner = std::dynamic_pointer_cast<protocol::TransactionImpl>(tx)->inner();
+    inner.dataHash.assign(bcos::crypto::HashType::size, 'h');
+    tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> output;
+    inner.writeTo(output);
+    BOOST_CHECK(!transactionFactory->precheckTransaction(bcos::ref(output.getByteBuffer())));
+}
+
+BOOST_AUTO_TEST_CASE(hashFromWire)
+{
+    // the leading version 0 of the data written as a Char instead of the ZeroTag, which decodes
+    // the same but is not the preimage of the hash
+    auto nonCanonical = [](bcos::bytes _encoded) {
+        BOOST_REQUIRE_EQUAL(_encoded[1] & 0x0F, 0x0C);
+        _encoded[1] &= 0xF0;
+        _encoded.insert(_encoded.begin() + 2, 0);
+        return _encoded;
+    };
+
+    auto tx = transactionFactory->createTransaction(0, "Target", bcos::asBytes("Arguments"), 800,
+        100, "testChain", "testGroup", 1000, cryptoSuite->signatureImpl()->generateKeyPair());
+    auto txInner = std::dynamic_pointer_cast<protocol::TransactionImpl>(tx)->inner();
+    txInner.dataHash.clear();
+    tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> txOutput;
+    txInner.writeTo(txOutput);
+    auto const& txBuffer = txOutput.getByteBuffer();
+
+    // the data to be hashed refers to the decoded buffer
+    auto decodedTx = transactionFactory->createTransaction(txBuffer, false);
+    auto encoded = decodedTx->encode(false);
+    auto hashFields = decodedTx->encode(true);
+    BOOST_CHECK(hashFields.data() > encoded.data());
+    BOOST_CHECK(hashFields.data() + hashFields.size() < encoded.data() + encoded.size());
+    BOOST_CHECK_EQUAL(decodedTx->hash(), tx->hash());
+    BOOST_CHECK_EQUAL(
+        transactionFactory->createTransaction(nonCanonical(txBuffer), false)->hash(), tx->hash());
+
+    auto receipt = transactionReceiptFactory->createReceipt(bcos::u256(8858), "contract",
+        std::make_shared<std::vector<bcos::protocol::LogEntry>>(), 0, bcos::asBytes("Output"), 888);
+    bcos::bytes receiptBuffer;
+    receipt->encode(receiptBuffer);
+    BOOST_CHECK_EQUAL(transactionReceiptFactory->createReceipt(receiptBuffer)->hash(),
+        receipt->hash());
+    BOOST_CHECK_EQUAL(transactionReceiptFactory->createReceipt(nonCanonical(receiptBuffer))->hash(),
+        receipt->hash());
+
+    auto header = blockHeaderFactory->createBlockHeader();
+    header->setNumber(100);
+    header->setTimestamp(200);
+    bcos::bytes headerBuffer;
+    header->encode(headerBuffer);
+    BOOST_CHECK_EQUAL(blockHeaderFactory->createBlockHeader(headerBuffer)->hash(), header->hash());
+    BOOST_CHECK_EQUAL(
+        blockHeaderFactory->createBlockHeader(nonCanonical(headerBuffer))->hash(), header->hash());
+
+    // the received data is no longer hashed once modified
+    auto modifiedHeader = blockHeaderFactory->createBlockHeader(headerBuffer);
+    modifiedHeader->setNumber(101);
+    auto expectedHeader = blockHeaderFactory->createBlockHeader();
+    expectedHeader->setNumber(101);
+    expectedHeader->setTimestamp(200);
+    BOOST_CHECK_EQUAL(modifiedHeader->hash(), expectedHeader->hash());
+    BOOST_CHECK(modifiedHeader->hash() != header->hash());
+
+    // the data hashes not of the hash size are calculated again rather than read as zero
+    txInner.dataHash.assign(5, 'h');
+    tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> shortHashTxOutput;
+    txInner.writeTo(shortHashTxOutput);
+    BOOST_CHECK_EQUAL(
+        transactionFactory->createTransaction(shortHashTxOutput.getByteBuffer(), false)->hash(),
+        tx->hash());
+    auto receiptInner = transactionReceiptFactory->createReceipt(receiptBuffer)->inner();
+    receiptInner.dataHash.assign(5, 'h');
+    tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> shortHashReceiptOutput;
+    receiptInner.writeTo(shortHashReceiptOutput);
+    BOOST_CHECK_EQUAL(
+        transactionReceiptFactory->createReceipt(shortHashReceiptOutput.getByteBuffer())->hash(),
+        receipt->hash());
+    auto headerInner = std::dynamic_pointer_cast<protocol::BlockHeaderImpl>(header)->inner();
+    headerInner.dataHash.assign(5, 'h');
+    tars::TarsOutputStream<bcostars::protocol::BufferWriterByteVector> shortHashHeaderOutput;
+    headerInner.writeTo(shortHashHeaderOutput);
+    BOOST_CHECK_EQUAL(
+        blockHeaderFactory->createBlockHeader(shortHashHeaderOutput.getByteBuffer())->hash(),
+        header->hash());
+}
+
+BOOST_AUTO_TEST_CASE(allocationScope)
+{
+    // the allocations are reported by the replaced operator new only if built with the tracking,
+    // so they are simulated here
+    auto& sites = AllocationSites::instance();
+    auto& outer = sites.site("test.outer");
+    auto& inner = sites.site("test.inner");
+    outer.reset();
+    inner.reset();
+    {
+        AllocationScope outerScope(outer);
+        AllocationScope::onAllocation(100);
+        {
+            AllocationScope innerScope(inner);
+            AllocationScope::onAllocation(10);
+            AllocationScope::onAllocation(20);
+        }
+        AllocationScope::onAllocation(1);
+    }
+    // out of any scope
+    AllocationScope::onAllocation(1000);
+
+    auto outerSnapshot = outer.snapshot();
+    BOOST_CHECK_EQUAL(outerSnapshot.scopes, 1);
+    BOOST_CHECK_EQUAL(outerSnapshot.allocations, 4);
+    BOOST_CHECK_EQUAL(outerSnapshot.bytes, 131);
+    auto innerSnapshot = inner.snapshot();
+    BOOST_CHECK_EQUAL(innerSnapshot.scopes, 1);
+    BOOST_CHECK_EQUAL(innerSnapshot.allocations, 2);
+    BOOST_CHECK_EQUAL(innerSnapshot.bytes, 30);
+    BOOST_CHECK(&sites.site("test.outer") == &outer);
+
+    // one in every four executions is tracked
+    sites.setSampleRate(4);
+    inner.reset();
+    for (int i = 0; i < 8; ++i)
+    {
+        AllocationScope scope(inner);
+        AllocationScope::onAllocation(8);
+    }
+    sites.setSampleRate(1);
+    innerSnapshot = inner.snapshot();
+    BOOST_CHECK_EQUAL(innerSnapshot.scopes, 2);
+    BOOST_CHECK_EQUAL(innerSnapshot.allocations, 2);
+    BOOST_CHECK_EQUAL(innerSnapshot.bytes, 16);
+
+    auto text = sites.toPrometheusText();
+    BOOST_CHECK(text.find("bcos_alloc_count_total{site=\"test.outer\"} 4\n") != std::string::npos);
+    BOOST_CHECK(text.find("bcos_alloc_bytes_total{site=\"test.inner\"} 16\n") != std::string::npos);
+
+    if (allocationTrackingEnabled())
+    {
+        auto& site = sites.site("test.tracked");
+        auto totals = allocationTotals();
+        {
+            BCOS_TARS_ALLOC_SCOPE("test.tracked");
+            auto buffer = std::make_unique<std::vector<char>>(64);
+            BOOST_CHECK(buffer);
+        }
+        BOOST_CHECK_EQUAL(site.snapshot().scopes, 1);
+        BOOST_CHECK_GE(site.snapshot().allocations, 2);
+        BOOST_CHECK_GE(site.snapshot().bytes, 64);
+        BOOST_CHECK_GE(allocationTotals().count, totals.count + 2);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace test
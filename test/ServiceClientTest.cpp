@@ -18,15 +18,36 @@
  * @author: yujiechen
  * @date 2021-10-13
  */
+#include "bcos-tars-protocol/client/BlockRangeFetcher.h"
+#include "bcos-tars-protocol/client/BlockTaggedCache.h"
+#include "bcos-tars-protocol/client/ClientAwaitable.h"
+#include "bcos-tars-protocol/client/ClientMetrics.h"
+#include "bcos-tars-protocol/client/ClientTrace.h"
+#include "bcos-tars-protocol/client/ConnectionStatus.h"
 #include "bcos-tars-protocol/client/GatewayServiceClient.h"
+#include "bcos-tars-protocol/client/LRUCache.h"
 #include "bcos-tars-protocol/client/LedgerServiceClient.h"
+#include "bcos-tars-protocol/client/LocalServiceRegistry.h"
 #include "bcos-tars-protocol/client/PBFTServiceClient.h"
+#include "bcos-tars-protocol/client/ProxyLanes.h"
 #include "bcos-tars-protocol/client/RpcServiceClient.h"
 #include "bcos-tars-protocol/client/SchedulerServiceClient.h"
+#include "bcos-tars-protocol/client/SharedPayload.h"
+#include "bcos-tars-protocol/client/ShmRing.h"
+#include "bcos-tars-protocol/client/ShmTransport.h"
 #include "bcos-tars-protocol/client/TxPoolServiceClient.h"
 #include <bcos-framework/testutils/TestPromptFixture.h>
 #include <boost/test/tools/old/interface.hpp>
 #include <boost/test/unit_test.hpp>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
 
 using namespace bcos;
 using namespace bcos::test;
@@ -68,6 +89,644 @@ BOOST_AUTO_TEST_CASE(testSchedulerService)
     bcostars::SchedulerServicePrx prx;
     std::make_shared<SchedulerServiceClient>(prx, nullptr);
 }
+BOOST_AUTO_TEST_CASE(testClientMetrics)
+{
+    for (uint64_t value = 0; value < 100000; value += 7)
+    {
+        auto index = LatencyHistogram::bucketIndex(value);
+        BOOST_CHECK(value < LatencyHistogram::bucketUpperBound(index));
+        BOOST_CHECK(index == 0 || value >= LatencyHistogram::bucketUpperBound(index - 1));
+    }
+
+    auto& metrics = BCOS_CLIENT_METRICS("TestService", "asyncTest");
+    metrics.reset();
+    bool called = false;
+    std::function<void(Error::Ptr, bytesPointer)> callback = [&called](Error::Ptr, bytesPointer) {
+        called = true;
+    };
+    callback = instrumentCallback(metrics, std::move(callback), 10);
+    BOOST_CHECK_EQUAL(metrics.snapshot().inFlight, 1);
+    callback(std::make_shared<Error>(-1, "error"), std::make_shared<bytes>(5));
+    BOOST_CHECK(called);
+
+    std::function<void(Error::Ptr)> oneWay;
+    oneWay = instrumentCallback(metrics, std::move(oneWay), 3);
+    BOOST_CHECK(!oneWay);
+
+    auto snapshot = metrics.snapshot();
+    BOOST_CHECK_EQUAL(snapshot.calls, 2);
+    BOOST_CHECK_EQUAL(snapshot.errors, 1);
+    BOOST_CHECK_EQUAL(snapshot.inFlight, 0);
+    BOOST_CHECK_EQUAL(snapshot.requestBytes, 13);
+    BOOST_CHECK_EQUAL(snapshot.responseBytes, 5);
+    BOOST_CHECK(snapshot.responseMeasured);
+    BOOST_CHECK_EQUAL(snapshot.latency.count, 1);
+
+    // the responses without bytes have no response bytes series
+    auto& numberMetrics = BCOS_CLIENT_METRICS("TestService", "asyncGetNumber");
+    numberMetrics.reset();
+    std::function<void(Error::Ptr, int64_t)> onNumber = [](Error::Ptr, int64_t) {};
+    onNumber = instrumentCallback(numberMetrics, std::move(onNumber));
+    onNumber(nullptr, 100);
+    BOOST_CHECK_EQUAL(numberMetrics.snapshot().latency.count, 1);
+    BOOST_CHECK(!numberMetrics.snapshot().responseMeasured);
+
+    auto text = ClientMetrics::instance().toPrometheusText();
+    BOOST_CHECK(
+        text.find("bcos_client_calls_total{service=\"TestService\",method=\"asyncTest\"} 2") !=
+        std::string::npos);
+    BOOST_CHECK(text.find("bcos_client_latency_us_count{service=\"TestService\"") !=
+                std::string::npos);
+    BOOST_CHECK(text.find("bcos_client_response_bytes_total{service=\"TestService\",method="
+                          "\"asyncTest\"} 5") != std::string::npos);
+    BOOST_CHECK(text.find("bcos_client_response_bytes_total{service=\"TestService\",method="
+                          "\"asyncGetNumber\"}") == std::string::npos);
+}
+BOOST_AUTO_TEST_CASE(testClientTrace)
+{
+    auto exporter = std::make_shared<InMemorySpanExporter>();
+    auto& tracer = ClientTracer::instance();
+    tracer.setExporter(exporter);
+
+    // not sampled
+    tracer.setSampleInterval(0);
+    auto span = tracer.startSpan("TxPoolService", "asyncSubmit");
+    BOOST_CHECK(!span.sampled());
+    BOOST_CHECK(span.context().empty());
+
+    // sample every root request, the request sent in the callback joins the trace
+    tracer.setSampleInterval(1);
+    std::function<void(Error::Ptr)> onSealed = [](Error::Ptr) {};
+    std::function<void(Error::Ptr)> onSubmitted = [&](Error::Ptr) {
+        auto child = tracer.startSpan("TxPoolService", "asyncSealTxs");
+        BOOST_CHECK(child.sampled());
+        onSealed = child.wrap(std::move(onSealed));
+    };
+    span = tracer.startSpan("TxPoolService", "asyncSubmit");
+    BOOST_CHECK(span.sampled());
+    auto context = TraceContext::fromTarsContext(span.context());
+    BOOST_CHECK(context.sampled());
+    onSubmitted = span.wrap(std::move(onSubmitted));
+    tracer.setSampleInterval(0);
+    onSubmitted(nullptr);
+    onSealed(std::make_shared<Error>(-1, "error"));
+    BOOST_CHECK(!TraceScope::current().sampled());
+
+    auto spans = exporter->trace(context.traceID);
+    BOOST_CHECK_EQUAL(spans.size(), 2);
+    BOOST_CHECK_EQUAL(spans[0].method, "asyncSubmit");
+    BOOST_CHECK_EQUAL(spans[0].spanID, context.spanID);
+    BOOST_CHECK_EQUAL(spans[0].parentSpanID, 0);
+    BOOST_CHECK(!spans[0].error);
+    BOOST_CHECK_EQUAL(spans[1].method, "asyncSealTxs");
+    BOOST_CHECK_EQUAL(spans[1].parentSpanID, context.spanID);
+    BOOST_CHECK(spans[1].error);
+    BOOST_CHECK(spans[1].endTime >= spans[1].startTime);
+    tracer.setExporter(nullptr);
+}
+BOOST_AUTO_TEST_CASE(testConnectionStatus)
+{
+    std::atomic_bool connected = {false};
+    std::atomic<int> probeCount = {0};
+    auto status = std::make_shared<ConnectionStatus>([&]() {
+        probeCount++;
+        return connected.load();
+    });
+    Error::Ptr error;
+    auto onError = [&error](Error::Ptr _error) { error = _error; };
+
+    // disconnected state is always probed again
+    BOOST_CHECK(!status->check("test", "asyncTest", onError));
+    BOOST_CHECK(error != nullptr);
+    BOOST_CHECK_EQUAL(probeCount, 1);
+
+    connected = true;
+    error = nullptr;
+    BOOST_CHECK(status->check("test", "asyncTest", onError));
+    BOOST_CHECK_EQUAL(probeCount, 2);
+    // connected state is cached
+    BOOST_CHECK(status->check("test", "asyncTest", onError));
+    BOOST_CHECK_EQUAL(probeCount, 2);
+    BOOST_CHECK(error == nullptr);
+
+    // the connected state is probed again once stale, so the lost connection is detected
+    // without the monitor
+    std::atomic<int> staleProbeCount = {0};
+    std::atomic_bool staleConnected = {true};
+    auto staleStatus = std::make_shared<ConnectionStatus>(
+        [&]() {
+            staleProbeCount++;
+            return staleConnected.load();
+        },
+        std::chrono::milliseconds(20));
+    BOOST_CHECK(staleStatus->check("test", "asyncTest", onError));
+    BOOST_CHECK(staleStatus->check("test", "asyncTest", onError));
+    BOOST_CHECK_EQUAL(staleProbeCount, 1);
+    staleConnected = false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    BOOST_CHECK(!staleStatus->check("test", "asyncTest", onError));
+    BOOST_CHECK_EQUAL(staleProbeCount, 2);
+    BOOST_CHECK(error != nullptr);
+    error = nullptr;
+
+    // the null proxy has no connection
+    bcostars::GatewayServicePrx proxy;
+    auto proxyStatus = ConnectionStatus::create(proxy);
+    BOOST_CHECK(!proxyStatus->check("test", "asyncTest", nullptr));
+
+    // nothing is refreshed in the background until the monitor is started
+    auto& monitor = ConnectionMonitor::instance();
+    monitor.registerStatus(status);
+    monitor.setRefreshInterval(std::chrono::hours(1));
+    BOOST_CHECK(!monitor.running());
+    monitor.refreshAll();
+    BOOST_CHECK_EQUAL(probeCount, 2);
+
+    // the pending refresh is taken by the first round, and refreshAll wakes up the next one
+    monitor.start();
+    BOOST_CHECK(monitor.running());
+    auto waitProbes = [&](int _count) {
+        for (int i = 0; i < 500 && probeCount < _count; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return probeCount >= _count;
+    };
+    BOOST_CHECK(waitProbes(3));
+    monitor.refreshAll();
+    BOOST_CHECK(waitProbes(4));
+    monitor.stop();
+    BOOST_CHECK(!monitor.running());
+    monitor.setRefreshInterval(std::chrono::milliseconds(1000));
+}
+BOOST_AUTO_TEST_CASE(testLRUCache)
+{
+    using Cache = LRUCache<int64_t, std::string>;
+    Cache disabledCache;
+    BOOST_CHECK(!disabledCache.enabled());
+    disabledCache.put(1, "1", 1);
+    BOOST_CHECK(!disabledCache.get(1));
+
+    // room for three entries of 36 bytes
+    Cache cache(3 * (Cache::c_entryOverhead + 36));
+    BOOST_CHECK(cache.enabled());
+    for (int64_t i = 0; i < 3; i++)
+    {
+        cache.put(i, std::to_string(i), 36);
+    }
+    BOOST_CHECK_EQUAL(*cache.get(0), "0");
+    // evict the least recently used entry 1
+    cache.put(3, "3", 36);
+    BOOST_CHECK(!cache.get(1));
+    BOOST_CHECK_EQUAL(*cache.get(0), "0");
+    BOOST_CHECK_EQUAL(*cache.get(2), "2");
+    BOOST_CHECK_EQUAL(*cache.get(3), "3");
+    // the entry larger than the capacity is never cached
+    cache.put(4, "4", 1024);
+    BOOST_CHECK(!cache.get(4));
+
+    auto stats = cache.stats();
+    BOOST_CHECK_EQUAL(stats.hits, 4);
+    BOOST_CHECK_EQUAL(stats.misses, 2);
+    BOOST_CHECK_EQUAL(stats.evictions, 1);
+    BOOST_CHECK_EQUAL(stats.entries, 3);
+    BOOST_CHECK_EQUAL(stats.bytes, 3 * (Cache::c_entryOverhead + 36));
+
+    cache.setCapacity(Cache::c_entryOverhead + 36);
+    BOOST_CHECK_EQUAL(cache.stats().entries, 1);
+    BOOST_CHECK_EQUAL(*cache.get(3), "3");
+    cache.clear();
+    BOOST_CHECK(!cache.get(3));
+}
+BOOST_AUTO_TEST_CASE(testBlockTaggedCache)
+{
+    BlockTaggedCache<std::string> cache;
+    cache.setEnabled(true);
+    // nothing is cached before any block is observed
+    cache.put("tx_count_limit", "1000", cache.latestBlockNumber());
+    BOOST_CHECK(!cache.get("tx_count_limit"));
+
+    BOOST_CHECK(cache.notifyBlockNumber(10));
+    BOOST_CHECK(!cache.notifyBlockNumber(9));
+    cache.put("tx_count_limit", "1000", cache.latestBlockNumber());
+    BOOST_CHECK_EQUAL(*cache.get("tx_count_limit"), "1000");
+
+    // the value queried before the newer block is observed is never cached
+    auto queriedBlockNumber = cache.latestBlockNumber();
+    BOOST_CHECK(cache.notifyBlockNumber(11));
+    BOOST_CHECK(!cache.get("tx_count_limit"));
+    cache.put("tx_count_limit", "2000", queriedBlockNumber);
+    BOOST_CHECK(!cache.get("tx_count_limit"));
+    cache.put("tx_count_limit", "2000", cache.latestBlockNumber());
+    BOOST_CHECK_EQUAL(*cache.get("tx_count_limit"), "2000");
+
+    auto stats = cache.stats();
+    BOOST_CHECK_EQUAL(stats.hits, 2);
+    BOOST_CHECK_EQUAL(stats.misses, 3);
+    cache.setEnabled(false);
+    BOOST_CHECK_EQUAL(cache.stats().entries, 0);
+}
+BOOST_AUTO_TEST_CASE(testBlockRangeFetcher)
+{
+    using BlockList = BlockRangeFetcher::BlockList;
+    struct Request
+    {
+        int64_t startNumber;
+        int64_t count;
+        BlockRangeFetcher::ChunkCallback callback;
+    };
+    // the latest block is 99
+    int64_t latestNumber = 99;
+    std::vector<Request> requests;
+    auto requestChunk = [&requests](int64_t _startNumber, int64_t _count,
+                            BlockRangeFetcher::ChunkCallback _callback) {
+        requests.push_back(Request{_startNumber, _count, std::move(_callback)});
+    };
+    auto respond = [&requests, latestNumber](size_t _index) {
+        auto request = requests[_index];
+        auto count = std::max<int64_t>(
+            0, std::min(request.count, latestNumber + 1 - request.startNumber));
+        request.callback(nullptr, std::make_shared<BlockList>(count));
+    };
+
+    std::vector<size_t> chunks;
+    bool finished = false;
+    int64_t fetchedCount = 0;
+    auto fetcher = std::make_shared<BlockRangeFetcher>(
+        requestChunk, 10, 200, 30, 2,
+        [&chunks](std::shared_ptr<BlockList> _blocks) { chunks.push_back(_blocks->size()); },
+        [&](Error::Ptr _error, int64_t _fetchedCount) {
+            BOOST_CHECK(!_error);
+            finished = true;
+            fetchedCount = _fetchedCount;
+        });
+    fetcher->start();
+    BOOST_CHECK_EQUAL(requests.size(), 2);
+
+    // the second chunk responds first and waits for the first one
+    respond(1);
+    BOOST_CHECK(chunks.empty());
+    BOOST_CHECK_EQUAL(requests.size(), 2);
+    respond(0);
+    BOOST_CHECK_EQUAL(chunks.size(), 2);
+    BOOST_CHECK_EQUAL(requests.size(), 4);
+    BOOST_CHECK_EQUAL(requests[2].startNumber, 70);
+    BOOST_CHECK_EQUAL(requests[3].startNumber, 100);
+
+    // blocks [70, 100) contains the latest block
+    respond(2);
+    BOOST_CHECK(!finished);
+    respond(3);
+    BOOST_CHECK(finished);
+    BOOST_CHECK_EQUAL(fetchedCount, 90);
+    BOOST_CHECK_EQUAL(chunks.size(), 3);
+
+    // stop at the first error
+    requests.clear();
+    chunks.clear();
+    finished = false;
+    fetcher = std::make_shared<BlockRangeFetcher>(
+        requestChunk, 0, 40, 10, 4,
+        [&chunks](std::shared_ptr<BlockList> _blocks) { chunks.push_back(_blocks->size()); },
+        [&](Error::Ptr _error, int64_t _fetchedCount) {
+            BOOST_CHECK(_error);
+            finished = true;
+            fetchedCount = _fetchedCount;
+        });
+    fetcher->start();
+    BOOST_CHECK_EQUAL(requests.size(), 4);
+    respond(0);
+    requests[1].callback(std::make_shared<Error>(-1, "error"), nullptr);
+    BOOST_CHECK(finished);
+    BOOST_CHECK_EQUAL(fetchedCount, 10);
+    respond(2);
+    respond(3);
+    BOOST_CHECK_EQUAL(chunks.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(testSharedPayload)
+{
+    bcos::bytes data(1024, 'a');
+    auto copiedCount = SharedPayload::copiedCount();
+    SharedPayload payload(bcos::ref(data));
+    BOOST_CHECK_EQUAL(SharedPayload::copiedCount(), copiedCount + 1);
+    BOOST_CHECK_EQUAL(payload.size(), data.size());
+    BOOST_CHECK(payload.ref().toBytes() == data);
+
+    // fan out to several destinations without copying the payload
+    std::vector<SharedPayload> destinations(8, payload);
+    for (auto const& destination : destinations)
+    {
+        BOOST_CHECK_EQUAL(destination.tarsData().data(), payload.tarsData().data());
+    }
+    BOOST_CHECK_EQUAL(SharedPayload::copiedCount(), copiedCount + 1);
+
+    // the encoded payload is taken over
+    std::vector<tars::Char> encoded(16, 'b');
+    auto encodedData = encoded.data();
+    SharedPayload encodedPayload(std::move(encoded));
+    BOOST_CHECK_EQUAL(encodedPayload.tarsData().data(), encodedData);
+    BOOST_CHECK_EQUAL(SharedPayload::copiedCount(), copiedCount + 1);
+    BOOST_CHECK(SharedPayload().empty());
+}
+
+BOOST_AUTO_TEST_CASE(testProxyLanes)
+{
+    // the proxies named "down" have no active endpoints
+    auto createStatus = [](std::shared_ptr<std::string> const& _proxy) {
+        return std::make_shared<ConnectionStatus>([_proxy]() { return *_proxy != "down"; });
+    };
+    auto defaultProxy = std::make_shared<std::string>("default");
+    auto defaultStatus = createStatus(defaultProxy);
+    ProxyLanes<std::shared_ptr<std::string>> lanes(defaultProxy, defaultStatus, createStatus);
+    // all the lanes fall back to the default proxy
+    BOOST_CHECK_EQUAL(lanes.proxy(ProxyLane::Consensus), defaultProxy);
+    BOOST_CHECK_EQUAL(lanes.proxyOfModule(1000), defaultProxy);
+    BOOST_CHECK_EQUAL(lanes.proxyOfMethod("asyncSendBroadcastMessage"), defaultProxy);
+    BOOST_CHECK_EQUAL(lanes.lane(ProxyLane::Bulk).status, defaultStatus);
+
+    auto consensusProxy = std::make_shared<std::string>("consensus");
+    auto bulkProxy = std::make_shared<std::string>("bulk");
+    lanes.setLaneProxy(ProxyLane::Consensus, consensusProxy);
+    lanes.setLaneProxy(ProxyLane::Bulk, bulkProxy);
+    lanes.routeModule(1000, ProxyLane::Consensus);
+    lanes.routeModule(2000, ProxyLane::Bulk);
+    lanes.routeMethod("asyncSendBroadcastMessage", ProxyLane::Bulk);
+
+    BOOST_CHECK_EQUAL(lanes.proxyOfModule(1000), consensusProxy);
+    BOOST_CHECK_EQUAL(lanes.proxyOfModule(2000), bulkProxy);
+    BOOST_CHECK_EQUAL(lanes.proxyOfModule(2001), defaultProxy);
+    BOOST_CHECK_EQUAL(lanes.proxyOfMethod("asyncSendBroadcastMessage"), bulkProxy);
+    BOOST_CHECK_EQUAL(lanes.proxyOfMethod("asyncSendMessageByNodeID"), defaultProxy);
+    BOOST_CHECK_EQUAL(lanes.proxy(), defaultProxy);
+
+    // every lane proxy is checked by its own status
+    auto const& bulkLane = lanes.laneOfMethod("asyncSendBroadcastMessage");
+    BOOST_CHECK(bulkLane.status != defaultStatus);
+    BOOST_CHECK_EQUAL(lanes.laneOfModule(1000).status, lanes.lane(ProxyLane::Consensus).status);
+    BOOST_CHECK_EQUAL(lanes.laneOfModule(2001).status, defaultStatus);
+    auto downProxy = std::make_shared<std::string>("down");
+    lanes.setLaneProxy(ProxyLane::Bulk, downProxy);
+    size_t failedCount = 0;
+    auto onError = [&failedCount](bcos::Error::Ptr _error) {
+        BOOST_CHECK(_error);
+        ++failedCount;
+    };
+    BOOST_CHECK(!lanes.laneOfModule(2000).status->check("test", "send", onError));
+    BOOST_CHECK(lanes.laneOfModule(1000).status->check("test", "send", onError));
+    BOOST_CHECK(defaultStatus->check("test", "send", onError));
+    BOOST_CHECK_EQUAL(failedCount, 1);
+    // the lane fetched before the proxy was replaced stays usable
+    BOOST_CHECK_EQUAL(bulkLane.proxy, bulkProxy);
+    lanes.setLaneProxy(ProxyLane::Bulk, bulkProxy);
+
+    // the routes are changed while routing
+    std::atomic_bool stopped = {false};
+    std::atomic<size_t> misrouted = {0};
+    std::thread router([&]() {
+        while (!stopped)
+        {
+            auto proxy = lanes.proxyOfModule(1000);
+            if (proxy != consensusProxy && proxy != bulkProxy)
+            {
+                ++misrouted;
+            }
+        }
+    });
+    for (int i = 0; i < 1000; ++i)
+    {
+        lanes.routeModule(1000, i % 2 ? ProxyLane::Consensus : ProxyLane::Bulk);
+    }
+    stopped = true;
+    router.join();
+    BOOST_CHECK_EQUAL(misrouted, 0);
+    BOOST_CHECK_EQUAL(lanes.proxyOfModule(1000), consensusProxy);
+
+    // the lanes without their own proxy follow the default proxy when it is replaced
+    auto newDefaultProxy = std::make_shared<std::string>("newDefault");
+    lanes.setLaneProxy(ProxyLane::Bulk, nullptr);
+    lanes.setLaneProxy(ProxyLane::Default, newDefaultProxy);
+    BOOST_CHECK_EQUAL(lanes.proxy(), newDefaultProxy);
+    BOOST_CHECK_EQUAL(lanes.proxy(ProxyLane::Bulk), newDefaultProxy);
+    BOOST_CHECK_EQUAL(lanes.proxyOfMethod("asyncSendBroadcastMessage"), newDefaultProxy);
+    BOOST_CHECK_EQUAL(lanes.proxy(ProxyLane::Consensus), consensusProxy);
+}
+
+struct FakeServiceInterface
+{
+    virtual ~FakeServiceInterface() = default;
+    virtual std::string name() const = 0;
+};
+struct FakeService : public FakeServiceInterface
+{
+    explicit FakeService(std::string _name) : m_name(std::move(_name)) {}
+    std::string name() const override { return m_name; }
+    std::string m_name;
+};
+
+BOOST_AUTO_TEST_CASE(testLocalServiceRegistry)
+{
+    auto createTarsClient = []() { return std::make_shared<FakeService>("tars"); };
+    // not registered, fall back to the tars client
+    BOOST_CHECK_EQUAL(createServiceClient<FakeServiceInterface>(
+                          ServiceTransport::InProcess, createTarsClient)
+                          ->name(),
+        "tars");
+
+    auto localService = std::make_shared<FakeService>("local");
+    LocalServiceRegistry::instance().registerService<FakeServiceInterface>(localService);
+    auto client =
+        createServiceClient<FakeServiceInterface>(ServiceTransport::InProcess, createTarsClient);
+    BOOST_CHECK_EQUAL(client.get(), localService.get());
+    BOOST_CHECK_EQUAL(
+        createServiceClient<FakeServiceInterface>(ServiceTransport::Tars, createTarsClient)
+            ->name(),
+        "tars");
+
+    LocalServiceRegistry::instance().unregisterService<FakeServiceInterface>();
+    BOOST_CHECK(!LocalServiceRegistry::instance().service<FakeServiceInterface>());
+}
+
+BOOST_AUTO_TEST_CASE(testShmRing)
+{
+    auto name = "bcos-test-ring-" + std::to_string(getpid());
+    auto producer = ShmRing::create(name, 256);
+    auto consumer = ShmRing::open(name);
+    BOOST_CHECK_EQUAL(consumer->capacity(), 256);
+    BOOST_CHECK(!producer->tryPush(bcos::bytesConstRef(nullptr, producer->maxPayloadSize() + 1)));
+    BOOST_CHECK(!consumer->tryConsume([](const char*, size_t) {}));
+
+    // the frames wrap around the end of the ring many times
+    for (size_t round = 0; round < 100; ++round)
+    {
+        bcos::bytes payload(round % 50 + 1, (bcos::byte)round);
+        BOOST_CHECK(producer->tryPush(bcos::ref(payload)));
+        bcos::bytes received;
+        BOOST_CHECK(consumer->tryConsume([&received](const char* _data, size_t _size) {
+            received.assign(_data, _data + _size);
+        }));
+        BOOST_CHECK(received == payload);
+    }
+
+    // full until the consumer pops
+    bcos::bytes payload(100, 'a');
+    size_t pushed = 0;
+    while (producer->tryPush(bcos::ref(payload)))
+    {
+        ++pushed;
+    }
+    BOOST_CHECK_GT(pushed, 0);
+    BOOST_CHECK(consumer->tryConsume([](const char*, size_t) {}));
+    BOOST_CHECK(producer->tryPush(bcos::ref(payload)));
+
+    // ordered between the threads
+    auto bigProducer = ShmRing::create(name + "-big", 4096);
+    auto bigConsumer = ShmRing::open(name + "-big");
+    constexpr uint32_t c_frames = 100000;
+    std::thread producerThread([&bigProducer]() {
+        for (uint32_t i = 0; i < c_frames; ++i)
+        {
+            bcos::bytes frame(i % 64 + 4, 0);
+            memcpy(frame.data(), &i, sizeof(i));
+            while (!bigProducer->tryPush(bcos::ref(frame)))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+    uint32_t expected = 0;
+    size_t misordered = 0;
+    while (expected < c_frames)
+    {
+        bigConsumer->tryConsume([&](const char* _data, size_t _size) {
+            uint32_t value = 0;
+            memcpy(&value, _data, sizeof(value));
+            misordered += (value != expected || _size != expected % 64 + 4) ? 1 : 0;
+            ++expected;
+        });
+    }
+    producerThread.join();
+    BOOST_CHECK_EQUAL(misordered, 0);
+
+    // the length out of the ring written by a broken peer is not read
+    auto brokenProducer = ShmRing::create(name + "-broken", 256);
+    auto brokenConsumer = ShmRing::open(name + "-broken");
+    bcos::bytes marked(8, 'm');
+    BOOST_REQUIRE(brokenProducer->tryPush(bcos::ref(marked)));
+    auto fd = shm_open(brokenProducer->name().c_str(), O_RDWR, 0600);
+    BOOST_REQUIRE(fd >= 0);
+    struct stat info;
+    BOOST_REQUIRE_EQUAL(fstat(fd, &info), 0);
+    auto address =
+        (char*)mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    BOOST_REQUIRE(address != MAP_FAILED);
+    // the payload follows its big-endian length
+    auto payload = std::search(address, address + info.st_size, marked.begin(), marked.end());
+    BOOST_REQUIRE(payload != address + info.st_size);
+    uint32_t length = htonl(1 << 20);
+    memcpy(payload - ShmRing::c_frameHeaderSize, &length, ShmRing::c_frameHeaderSize);
+    munmap(address, info.st_size);
+    BOOST_CHECK(!brokenConsumer->corrupt());
+    BOOST_CHECK(!brokenConsumer->tryConsume([](const char*, size_t) {}));
+    BOOST_CHECK(brokenConsumer->corrupt());
+}
+
+BOOST_AUTO_TEST_CASE(testShmTransport)
+{
+    auto channel = "bcos-test-channel-" + std::to_string(getpid());
+    ShmTransportServer server(channel, 64 * 1024);
+    server.registerHandler(
+        "echo", [](tars::RequestPacket&& _request, ShmTransportServer::Responder _respond) {
+            _respond(tars::TARSSERVERSUCCESS, std::move(_request.sBuffer));
+        });
+    server.registerHandler("ignore", [](tars::RequestPacket&&, ShmTransportServer::Responder) {});
+    server.start();
+
+    ShmTransportClient client(channel, "bcos.TestServer.EchoObj");
+    auto call = [&client](std::string const& _funcName, std::vector<tars::Char> _params) {
+        std::promise<std::pair<tars::Int32, std::vector<tars::Char>>> result;
+        client.invoke(_funcName, std::move(_params), {},
+            [&result](tars::Int32 _ret, tars::ResponsePacket&& _response) {
+                result.set_value({_ret, std::move(_response.sBuffer)});
+            });
+        return result.get_future().get();
+    };
+
+    std::vector<tars::Char> params(1000, 'x');
+    auto [ret, echo] = call("echo", params);
+    BOOST_CHECK_EQUAL(ret, tars::TARSSERVERSUCCESS);
+    BOOST_CHECK(echo == params);
+    BOOST_CHECK_EQUAL(call("unknown", params).first, tars::TARSSERVERNOFUNCERR);
+
+    client.setTimeout(std::chrono::milliseconds(50));
+    BOOST_CHECK_EQUAL(call("ignore", params).first, tars::TARSINVOKETIMEOUT);
+    // the one-way request has no response
+    client.invoke("echo", std::move(params), {}, nullptr);
+    client.setTimeout(std::chrono::milliseconds(30000));
+    BOOST_CHECK_EQUAL(call("echo", {}).first, tars::TARSSERVERSUCCESS);
+}
+
+#ifdef BCOS_TARS_COROUTINE
+struct FakeAwaitClient
+{
+    // responds synchronously
+    void asyncDouble(int _value, std::function<void(Error::Ptr, int)> _callback)
+    {
+        _callback(nullptr, _value * 2);
+    }
+    // responds when respond() is called
+    void asyncCheck(std::string const& _value, std::function<void(Error::Ptr&&)> _callback)
+    {
+        pending = [_value, _callback]() {
+            _callback(_value.empty() ? std::make_shared<Error>(-1, "empty") : nullptr);
+        };
+    }
+    std::function<void()> pending;
+};
+
+struct QueueClientExecutor : public ClientExecutor
+{
+    void execute(std::coroutine_handle<> _handle) override { handles.push_back(_handle); }
+    std::vector<std::coroutine_handle<>> handles;
+};
+
+DetachedClientTask awaitFakeClient(
+    FakeAwaitClient& _client, QueueClientExecutor& _executor, std::vector<std::string>& _steps)
+{
+    auto [error, value] = co_await callAsync(_client, &FakeAwaitClient::asyncDouble, 21);
+    _steps.push_back("double:" + std::to_string(value));
+    auto checkError = co_await callAsync(_client, &FakeAwaitClient::asyncCheck, std::string("x"));
+    _steps.push_back(checkError ? "check:error" : "check:ok");
+    checkError =
+        co_await callAsyncVia(_executor, _client, &FakeAwaitClient::asyncCheck, std::string());
+    _steps.push_back(checkError ? "check:error" : "check:ok");
+}
+
+BOOST_AUTO_TEST_CASE(testClientAwaitable)
+{
+    FakeAwaitClient client;
+    QueueClientExecutor executor;
+    std::vector<std::string> steps;
+    awaitFakeClient(client, executor, steps);
+    // the synchronous response resumes at once
+    BOOST_CHECK_EQUAL(steps.size(), 1);
+    BOOST_CHECK_EQUAL(steps[0], "double:42");
+
+    // resumed inline by the response
+    client.pending();
+    BOOST_CHECK_EQUAL(steps.size(), 2);
+    BOOST_CHECK_EQUAL(steps[1], "check:ok");
+
+    // resumed by the executor
+    client.pending();
+    BOOST_CHECK_EQUAL(steps.size(), 2);
+    BOOST_CHECK_EQUAL(executor.handles.size(), 1);
+    executor.handles[0].resume();
+    BOOST_CHECK_EQUAL(steps.size(), 3);
+    BOOST_CHECK_EQUAL(steps[2], "check:error");
+}
+#endif
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcostars
\ No newline at end of file